@@ -0,0 +1,363 @@
+#pragma once
+
+#include "YAMLParser.hpp"
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+// C++20 ̃R[`gꍇ YAMLFuture  co_await ł悤ɂ
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#include <coroutine>
+#define YAMLASYNC_HAS_COROUTINES 1
+#endif
+#endif
+
+/// <summary>
+/// ꂽp̃XbhŏɎs܂B񓯊̓ǂݍ݂ƕۑŃt@Co͂ƃp[XĂяõXbhO߂Ɏg܂B
+/// jۂ́Aςׂ݂̏ĎsIĂXbhI܂B
+/// </summary>
+class YAMLExecutor
+{
+public:
+	/// <summary>
+	/// w肳ꂽ̃XbhN܂B
+	/// </summary>
+	/// <param name="In_ThreadCount">sXbh̐B0 ̏ꍇ1B</param>
+	explicit YAMLExecutor(_In_ size_t In_ThreadCount = 1)
+	{
+		In_ThreadCount = (std::max)(In_ThreadCount, static_cast<size_t>(1));
+		m_Threads.reserve(In_ThreadCount);
+		for (size_t i = 0; i < In_ThreadCount; ++i)
+			m_Threads.emplace_back(&YAMLExecutor::WorkLoop, this);
+	}
+	YAMLExecutor(const YAMLExecutor&) = delete;
+	YAMLExecutor& operator=(const YAMLExecutor&) = delete;
+
+	~YAMLExecutor()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Stopping = true;
+		}
+		m_Condition.notify_all();
+		for (auto& thread : m_Threads)
+			thread.join();
+	}
+
+	/// <summary>
+	/// 𓊓܂B͂ꂩ̃XbhŁAꂽɊJn܂B
+	/// </summary>
+	/// <param name="In_Task">s鏈BO𓊂ȂƁB</param>
+	void Post(_In_ std::function<void()> In_Task)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Tasks.push_back(std::move(In_Task));
+		}
+		m_Condition.notify_one();
+	}
+
+	/// <summary>
+	/// 񓯊̓ǂݍ݂ƕۑŎgA1̃Xbhs擾܂B̌ĂяoŃXbhN܂B
+	/// </summary>
+	static YAMLExecutor& Default()
+	{
+		static YAMLExecutor executor(1);
+		return executor;
+	}
+
+private:
+
+	void WorkLoop()
+	{
+		while (true)
+		{
+			std::function<void()> task;
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_Condition.wait(lock, [this]() { return m_Stopping || !m_Tasks.empty(); });
+				if (m_Tasks.empty()) return;
+				task = std::move(m_Tasks.front());
+				m_Tasks.pop_front();
+			}
+			task();
+		}
+	}
+
+	std::mutex m_Mutex;
+	std::condition_variable m_Condition;
+	std::deque<std::function<void()>> m_Tasks;
+	bool m_Stopping = false;
+	std::vector<std::thread> m_Threads;
+};
+
+/// <summary>
+/// 񓯊̏̒~v邽߂̃g[NłBRs[g[N͓vL܂B
+/// </summary>
+class YAMLCancelToken
+{
+public:
+	YAMLCancelToken() : m_Flag(std::make_shared<std::atomic<bool>>(false)) {}
+
+	inline void Cancel() noexcept { m_Flag->store(true, std::memory_order_relaxed); }
+	inline bool IsCancelled() const noexcept { return m_Flag->load(std::memory_order_relaxed); }
+	inline const std::atomic<bool>* GetFlag() const noexcept { return m_Flag.get(); }
+
+private:
+	std::shared_ptr<std::atomic<bool>> m_Flag;
+};
+
+template <class T>
+class YAMLPromise;
+
+/// <summary>
+/// 񓯊̏̌ʂ󂯎邽߂ std::future ɑNXłB
+/// ҂ Wait/Get ɉāAɌĂ΂֐ Then œo^łAC++20 ̃R[`ł co_await ő҂Ă܂B
+/// Then ̊֐ co_await ̍ĊJ́AXbh(łɊĂꍇ͌ĂяõXbh)Ŏs܂B
+/// </summary>
+template <class T>
+class YAMLFuture
+{
+public:
+	YAMLFuture() = default;
+
+	inline bool Valid() const noexcept { return static_cast<bool>(m_State); }
+
+	inline bool IsReady() const
+	{
+		std::lock_guard<std::mutex> lock(m_State->mutex);
+		return m_State->ready;
+	}
+
+	inline void Wait() const
+	{
+		std::unique_lock<std::mutex> lock(m_State->mutex);
+		m_State->condition.wait(lock, [this]() { return m_State->ready; });
+	}
+
+	/// <summary>
+	/// w肳ꂽԂ܂Ŋ҂܂B
+	/// </summary>
+	/// <returns>ꍇ trueAԐ؂̏ꍇ false Ԃ܂B</returns>
+	template <class Rep, class Period>
+	bool WaitFor(_In_ const std::chrono::duration<Rep, Period>& In_Timeout) const
+	{
+		std::unique_lock<std::mutex> lock(m_State->mutex);
+		return m_State->condition.wait_for(lock, In_Timeout, [this]() { return m_State->ready; });
+	}
+
+	/// <summary>
+	/// ҂Čʂo܂BO𓊂ꍇ͍đo܂Bʂô1񂾂łB
+	/// </summary>
+	T Get()
+	{
+		Wait();
+		if (m_State->error) std::rethrow_exception(m_State->error);
+		return std::move(*m_State->value);
+	}
+
+	/// <summary>
+	/// ƂɌĂ΂֐o^܂Bo^ł֐1łB
+	/// Cxg[vgꍇ́Å֐Cxg[ṽXbh֏]ĂB
+	/// </summary>
+	/// <param name="In_Continuation">Ȃ֐B</param>
+	void Then(_In_ std::function<void()> In_Continuation)
+	{
+		if (!SetContinuation(In_Continuation)) In_Continuation();
+	}
+
+#if defined(YAMLASYNC_HAS_COROUTINES)
+	inline bool await_ready() const { return IsReady(); }
+	inline bool await_suspend(_In_ std::coroutine_handle<> In_Handle) { return SetContinuation([In_Handle]() { In_Handle.resume(); }); }
+	inline T await_resume() { return Get(); }
+#endif
+
+private:
+	friend class YAMLPromise<T>;
+
+	struct State
+	{
+		std::mutex mutex;
+		std::condition_variable condition;
+		bool ready = false;
+		std::optional<T> value;
+		std::exception_ptr error;
+		std::function<void()> continuation;
+	};
+
+	explicit YAMLFuture(_In_ std::shared_ptr<State> In_State) : m_State(std::move(In_State)) {}
+
+	// łΊ֐o^ true ԂBς݂łΓo^ false Ԃ
+	bool SetContinuation(_In_ std::function<void()> In_Continuation)
+	{
+		std::lock_guard<std::mutex> lock(m_State->mutex);
+		if (m_State->ready) return false;
+		m_State->continuation = std::move(In_Continuation);
+		return true;
+	}
+
+	std::shared_ptr<State> m_State;
+};
+
+/// <summary>
+/// YAMLFuture Ɍʂݒ肷鑤łBstd::promise ɑ܂B
+/// </summary>
+template <class T>
+class YAMLPromise
+{
+public:
+	YAMLPromise() : m_State(std::make_shared<State>()) {}
+
+	inline YAMLFuture<T> GetFuture() const { return YAMLFuture<T>(m_State); }
+
+	inline void SetValue(_In_ T In_Value) { Complete([&](State& In_State) { In_State.value.emplace(std::move(In_Value)); }); }
+	inline void SetException(_In_ std::exception_ptr In_Error) { Complete([&](State& In_State) { In_State.error = std::move(In_Error); }); }
+
+private:
+	using State = typename YAMLFuture<T>::State;
+
+	template <class Setter>
+	void Complete(_In_ Setter&& In_Setter)
+	{
+		std::function<void()> continuation;
+		{
+			std::lock_guard<std::mutex> lock(m_State->mutex);
+			In_Setter(*m_State);
+			m_State->ready = true;
+			continuation = std::move(m_State->continuation);
+		}
+		m_State->condition.notify_all();
+		if (continuation) continuation();
+	}
+
+	std::shared_ptr<State> m_State;
+};
+
+/// <summary>
+/// 񓯊̓ǂݍ݂ƕۑ̌ʂ̏ԂłB
+/// </summary>
+enum class YAMLAsyncStatus
+{
+	Succeeded,
+	Failed,
+	Cancelled
+};
+
+// 񓯊̓ǂݍ݂ƕۑ̐ݒłB
+struct YAMLAsyncOptions
+{
+	YAMLExecutor* executor = nullptr;		// ss(nullptr ̏ꍇ YAMLExecutor::Default)
+	YAMLCancelToken cancel;					// ~̗v
+	std::function<void(const YAMLParser::YAMLProgress&)> onProgress;	// i̒ʒm(s̃XbhĂ΂)
+};
+
+// 񓯊̓ǂݍ݂̌ʂłB
+struct YAMLLoadResult
+{
+	YAMLAsyncStatus status = YAMLAsyncStatus::Failed;
+	std::shared_ptr<YAMLParser> parser;		// ǂݍ񂾃p[T[Bsꍇ GetDiagnostics ŌmFł
+};
+
+/// <summary>
+/// YAMLt@C̓ǂݍ݂ƕۑs̃XbhōsAĂяõXbh҂Ȃ֐QłB
+/// ǂݍ݁AR[hϊAp[XAoׂ͂ĎsōsAĂяoł͕ۑf[^ Fork s܂B
+/// </summary>
+class YAMLAsync
+{
+public:
+
+	/// <summary>
+	/// YAMLt@C񓯊ɓǂݍ݂܂B
+	/// </summary>
+	/// <param name="In_FilePath">ǂݍYAMLt@C̃pXB</param>
+	/// <param name="In_Options">sA~̗vAi̒ʒmB</param>
+	/// <returns>ǂݍ݂̌ʂ󂯎 YAMLFuture Ԃ܂B</returns>
+	static YAMLFuture<YAMLLoadResult> ParseYAMLAsync(_In_ const std::string& In_FilePath, _In_ YAMLAsyncOptions In_Options = YAMLAsyncOptions())
+	{
+		return ParseYAMLAsync(std::make_shared<YAMLParser>(), In_FilePath, std::move(In_Options));
+	}
+
+	/// <summary>
+	/// ݒς݂̃p[T[(⃁\[XȂ)YAMLt@C񓯊ɓǂݍ݂܂B܂Ńp[T[ɐGȂłB
+	/// </summary>
+	/// <param name="In_Parser">ǂݍ݂Ɏgp[T[BʂƂĂ̂܂ܕԂ܂B</param>
+	/// <param name="In_FilePath">ǂݍYAMLt@C̃pXB</param>
+	/// <param name="In_Options">sA~̗vAi̒ʒmB</param>
+	/// <returns>ǂݍ݂̌ʂ󂯎 YAMLFuture Ԃ܂B</returns>
+	static YAMLFuture<YAMLLoadResult> ParseYAMLAsync(_In_ std::shared_ptr<YAMLParser> In_Parser, _In_ const std::string& In_FilePath,
+		_In_ YAMLAsyncOptions In_Options = YAMLAsyncOptions())
+	{
+		YAMLPromise<YAMLLoadResult> promise;
+		YAMLFuture<YAMLLoadResult> future = promise.GetFuture();
+		YAMLExecutor& executor = In_Options.executor ? *In_Options.executor : YAMLExecutor::Default();
+		executor.Post([promise, parser = std::move(In_Parser), filePath = In_FilePath, options = std::move(In_Options)]() mutable
+			{
+				try
+				{
+					YAMLParser::YAMLParseControl control;
+					control.cancel = options.cancel.GetFlag();
+					control.onProgress = options.onProgress;
+					parser->SetParseControl(&control);
+					const bool succeeded = parser->ParseYAML(filePath);
+					parser->SetParseControl(nullptr);
+
+					YAMLLoadResult result;
+					result.status = succeeded ? YAMLAsyncStatus::Succeeded : (options.cancel.IsCancelled() ? YAMLAsyncStatus::Cancelled : YAMLAsyncStatus::Failed);
+					result.parser = std::move(parser);
+					promise.SetValue(std::move(result));
+				}
+				catch (...)
+				{
+					promise.SetException(std::current_exception());
+				}
+			});
+		return future;
+	}
+
+	/// <summary>
+	/// YAMLf[^񓯊ɕۑ܂BĂяo_̃f[^ Fork ĕۑ邽߁A҂Ɍ̃p[T[ύXł܂B
+	/// ~̗v͏on߂O܂ŗLłBon߂́At@Cr܂ł̏ԂŎcȂ悤Ō܂ŏo܂B
+	/// </summary>
+	/// <param name="In_Parser">ۑp[T[B</param>
+	/// <param name="In_FilePath">ۑ̃t@CpXB</param>
+	/// <param name="In_SaveOptions">o̐ݒB</param>
+	/// <param name="In_Options">sA~̗vAi̒ʒmB</param>
+	/// <returns>ۑ̌ʂ󂯎 YAMLFuture Ԃ܂B</returns>
+	static YAMLFuture<YAMLAsyncStatus> SaveYAMLAsync(_In_ const YAMLParser& In_Parser, _In_ const std::string& In_FilePath,
+		_In_ const YAMLParser::YAMLSaveOptions& In_SaveOptions = YAMLParser::YAMLSaveOptions(), _In_ YAMLAsyncOptions In_Options = YAMLAsyncOptions())
+	{
+		YAMLPromise<YAMLAsyncStatus> promise;
+		YAMLFuture<YAMLAsyncStatus> future = promise.GetFuture();
+		YAMLExecutor& executor = In_Options.executor ? *In_Options.executor : YAMLExecutor::Default();
+		executor.Post([promise, snapshot = std::make_shared<const YAMLParser>(In_Parser.Fork()), filePath = In_FilePath,
+			saveOptions = In_SaveOptions, options = std::move(In_Options)]() mutable
+			{
+				try
+				{
+					if (options.cancel.IsCancelled())
+					{
+						promise.SetValue(YAMLAsyncStatus::Cancelled);
+						return;
+					}
+					if (options.onProgress) options.onProgress({ YAMLParser::YAMLProgress::Stage::Write, 0, 0 });
+					const bool succeeded = snapshot->SaveYAML(filePath, saveOptions);
+					if (succeeded && options.onProgress)
+					{
+						std::error_code ec;
+						const uint64_t size = std::filesystem::file_size(filePath, ec);
+						if (!ec) options.onProgress({ YAMLParser::YAMLProgress::Stage::Write, size, size });
+					}
+					promise.SetValue(succeeded ? YAMLAsyncStatus::Succeeded : YAMLAsyncStatus::Failed);
+				}
+				catch (...)
+				{
+					promise.SetException(std::current_exception());
+				}
+			});
+		return future;
+	}
+};
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "YAMLParser.hpp"
+#include <atomic>
+#include <mutex>
+
+/// <summary>
+/// Xbh瓯ɓǂݏłYAMLhLgłB
+/// ǂݎ͕sς̃XibvVbgQƂA͕ύXpX̃m[h𕡐VłăAg~bNɌJ܂B
+/// ݓm͒񉻂܂Aǂݍ݂ݒ̕ύX֐̎st@C̓ǂݍ݂҂Ƃ͂܂B
+/// J̔ł̎擾ɂ std::atomic_load g߁AWCu̒ZbN𔺂A҂Ȃ(wait-free)ł͂܂B
+/// </summary>
+class YAMLConcurrentDocument
+{
+public:
+	using Snapshot = std::shared_ptr<const YAMLParser>;
+
+	/// <summary>
+	/// XbhƂɕێǂݎnhłBJς݂̔łςĂȂ΁A
+	/// ł̔ԍǂނŃLbVς݂̃XibvVbgԂ߁Astd::atomic_load ̃bNQƃJEg̑܂B
+	/// 1̃nh𕡐̃XbhŋLȂłB
+	/// </summary>
+	class Reader
+	{
+	public:
+		explicit Reader(_In_ const YAMLConcurrentDocument& In_Document) : m_Document(&In_Document) {}
+
+		/// <summary>
+		/// ŐV̔łYAMLf[^擾܂B߂l͎ Get() ĂԂ܂ŗLłB
+		/// </summary>
+		inline const YAMLParser& Get()
+		{
+			const uint64_t version = m_Document->m_Version.load(std::memory_order_acquire);
+			if (version != m_Version || !m_Snapshot)
+			{
+				m_Snapshot = m_Document->GetSnapshot();
+				m_Version = version;
+			}
+			return *m_Snapshot;
+		}
+
+		inline const YAMLParser* operator->() { return &Get(); }
+
+	private:
+		const YAMLConcurrentDocument* m_Document;
+		Snapshot m_Snapshot;
+		uint64_t m_Version = 0;
+	};
+
+	YAMLConcurrentDocument() : m_Snapshot(std::make_shared<const YAMLParser>()) {}
+	explicit YAMLConcurrentDocument(_In_ YAMLParser In_Initial)
+		: m_Snapshot(std::make_shared<const YAMLParser>(std::move(In_Initial))) {}
+	YAMLConcurrentDocument(const YAMLConcurrentDocument&) = delete;
+	YAMLConcurrentDocument& operator=(const YAMLConcurrentDocument&) = delete;
+
+	/// <summary>
+	/// YAMLt@Cǂݍ݁AVłƂČJ܂Bsꍇ݂͌̔łێ܂B
+	/// p[X̏AXJ[̋LAlẑlApXCfbNX̐ݒ݂͌̔łp܂B
+	/// </summary>
+	/// <param name="In_FilePath">ǂݍYAMLt@C̃pXB</param>
+	/// <returns>ǂݍ݂ɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	bool ParseYAML(_In_ const std::string& In_FilePath)
+	{
+		auto parser = std::make_shared<YAMLParser>(GetSnapshot()->Fork());
+		if (!parser->ParseYAML(In_FilePath)) return false;
+
+		std::lock_guard<std::mutex> lock(m_WriteMutex);
+		Publish(std::move(parser));
+		return true;
+	}
+
+	/// <summary>
+	/// ݌JĂł̃XibvVbg擾܂B擾XibvVbg͈ȍ~݂̏̉e󂯂܂B
+	/// </summary>
+	inline Snapshot GetSnapshot() const { return std::atomic_load(&m_Snapshot); }
+
+	/// <summary>
+	/// ݌JĂł̔ԍ擾܂B݂J邽тɑ܂B
+	/// </summary>
+	inline uint64_t GetVersion() const noexcept { return m_Version.load(std::memory_order_acquire); }
+
+	/// <summary>
+	/// ݂̔łɐVłA֐ŕύXĂJ܂B
+	/// np[T[݂͌̔ł̐󂢃Rs[ŁASetn֐ GenerateNode ͕ύXpX̃m[h𕡐܂B
+	/// </summary>
+	/// <param name="In_Mutator">YAMLParser&amp; 󂯎Abool ԂύX֐Bfalse Ԃꍇ͌J܂B</param>
+	/// <returns>ύXJꍇ trueAꍇ false Ԃ܂B</returns>
+	template <class Mutator>
+	bool Update(_In_ Mutator&& In_Mutator)
+	{
+		std::lock_guard<std::mutex> lock(m_WriteMutex);
+		const Snapshot current = std::atomic_load(&m_Snapshot);
+		auto next = std::make_shared<YAMLParser>(current->Fork());	// pXCfbNX͕ύX̂Ȃ݂̔łƋL
+		if (!In_Mutator(*next)) return false;
+		Publish(std::move(next));
+		return true;
+	}
+
+	inline std::string GetString(_In_ const std::string& In_keyPath, _In_ const bool& In_IncludeQuotes = false) const
+	{
+		return GetSnapshot()->GetString(In_keyPath, In_IncludeQuotes);
+	}
+	inline bool GetBool(_In_ const std::string& In_keyPath) const { return GetSnapshot()->GetBool(In_keyPath); }
+	inline int GetInt(_In_ const std::string& In_keyPath) const { return GetSnapshot()->GetInt(In_keyPath); }
+	inline float GetFloat(_In_ const std::string& In_keyPath) const { return GetSnapshot()->GetFloat(In_keyPath); }
+	inline double GetDouble(_In_ const std::string& In_keyPath) const { return GetSnapshot()->GetDouble(In_keyPath); }
+	inline bool HasKey(_In_ const std::string& In_keyPath) const { return GetSnapshot()->HasKey(In_keyPath); }
+
+	inline bool SetString(_In_ const std::string& In_keyPath, _In_ const std::string& In_Value)
+	{
+		return Update([&](YAMLParser& In_Parser) { return In_Parser.SetString(In_keyPath, In_Value); });
+	}
+	inline bool SetBool(_In_ const std::string& In_keyPath, _In_ const bool& In_Value)
+	{
+		return Update([&](YAMLParser& In_Parser) { return In_Parser.SetBool(In_keyPath, In_Value); });
+	}
+	inline bool SetInt(_In_ const std::string& In_keyPath, _In_ const int& In_Value)
+	{
+		return Update([&](YAMLParser& In_Parser) { return In_Parser.SetInt(In_keyPath, In_Value); });
+	}
+	inline bool SetFloat(_In_ const std::string& In_keyPath, _In_ const float& In_Value)
+	{
+		return Update([&](YAMLParser& In_Parser) { return In_Parser.SetFloat(In_keyPath, In_Value); });
+	}
+	inline bool SetDouble(_In_ const std::string& In_keyPath, _In_ const double& In_Value)
+	{
+		return Update([&](YAMLParser& In_Parser) { return In_Parser.SetDouble(In_keyPath, In_Value); });
+	}
+
+private:
+
+	// ݃bNێԂŌĂяo
+	void Publish(_In_ std::shared_ptr<YAMLParser> In_Next)
+	{
+		std::atomic_store(&m_Snapshot, Snapshot(std::move(In_Next)));
+		m_Version.fetch_add(1, std::memory_order_release);
+	}
+
+	Snapshot m_Snapshot;				// std::atomic_load / std::atomic_store ł̂݃ANZX
+	std::atomic<uint64_t> m_Version{ 1 };
+	std::mutex m_WriteMutex;
+};
@@ -0,0 +1,217 @@
+#pragma once
+
+#include "YAMLParser.hpp"
+#include <future>
+#include <list>
+#include <mutex>
+
+/// <summary>
+/// YAMLt@C𕡐ӏǂݍލۂɁAp[XʂvZXŜŋLLbVłB
+/// t@C͐KpXƃTCYEXVŎʂAt@CύXꂽꍇ̂ݍăp[X܂B
+/// ԂhLg͓ǂݎpŁALbVǂoꂽQƂĂԂ͗LłB
+/// </summary>
+class YAMLDocumentCache
+{
+public:
+	using Document = std::shared_ptr<const YAMLParser>;
+
+	/// <summary>
+	/// vZXŜŋLLbṼCX^X擾܂B
+	/// </summary>
+	static YAMLDocumentCache& Instance()
+	{
+		static YAMLDocumentCache instance;
+		return instance;
+	}
+
+	/// <summary>
+	/// w肳ꂽYAMLt@C̃hLg擾܂BLbVÂ݂Ȃꍇ̓p[X܂B
+	/// t@C𕡐̃XbhɗvꍇAp[X͈xs܂B
+	/// </summary>
+	/// <param name="In_FilePath">ǂݍYAMLt@C̃pXB</param>
+	/// <returns>p[Xς݂̃hLgBǂݍ݂Ɏsꍇ nullptr Ԃ܂B</returns>
+	Document Get(_In_ const std::string& In_FilePath)
+	{
+		if (In_FilePath.empty()) return nullptr;
+
+		std::error_code ec;
+		const std::string key = std::filesystem::canonical(In_FilePath, ec).string();
+		FileIdentity identity;
+		if (ec || !YAMLParser::GetSourceIdentity(key, identity.size, identity.time))
+		{
+			YAMLParser::Log(YAMLParser::LogLevel::Error, "t@CJ܂: " + In_FilePath);
+			return nullptr;
+		}
+
+		std::promise<Document> promise;
+		uint64_t generation = 0;
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			auto itr = m_Entries.find(key);
+			if (itr != m_Entries.end() && itr->second.identity == identity)
+			{
+				m_LRU.splice(m_LRU.begin(), m_LRU, itr->second.lruPos);
+				const std::shared_future<Document> document = itr->second.document;
+				// p[X̏ꍇ̓bNĂ犮҂
+				lock.unlock();
+				return document.get();
+			}
+			if (itr != m_Entries.end()) EraseEntry(itr);
+
+			generation = ++m_Generation;
+			m_LRU.push_front(key);
+			Entry& entry = m_Entries[key];
+			entry.identity = identity;
+			entry.generation = generation;
+			entry.document = promise.get_future().share();
+			entry.lruPos = m_LRU.begin();
+		}
+
+		// ̃t@C̎擾WȂ悤Ap[X̓bN̊Oōs
+		Document document;
+		try
+		{
+			auto parser = std::make_shared<YAMLParser>();
+			if (parser->ParseYAML(key)) document = std::move(parser);
+		}
+		catch (...)
+		{
+			promise.set_value(nullptr);
+			RemoveIfCurrent(key, generation);
+			throw;
+		}
+		promise.set_value(document);
+		// ς̓c[ŜH邽߁AbN̊Oŋ߂Ă
+		const size_t memory = document ? document->EstimateMemoryUsage() : 0;
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		auto itr = m_Entries.find(key);
+		if (itr != m_Entries.end() && itr->second.generation == generation)
+		{
+			if (!document)
+			{
+				EraseEntry(itr);	// sʂ̓LbVȂ
+			}
+			else
+			{
+				itr->second.memory = memory;
+				m_MemoryUsage += itr->second.memory;
+				Evict();
+			}
+		}
+		return document;
+	}
+
+	/// <summary>
+	/// LbVێhLg̍vʂ̏ݒ肵܂Bߕ͍łÂgꂽ̂j܂B
+	/// </summary>
+	/// <param name="In_Bytes">̃oCgB</param>
+	void SetMemoryLimit(_In_ const size_t& In_Bytes)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_MemoryLimit = In_Bytes;
+		Evict();
+	}
+
+	/// <summary>
+	/// LbVێĂhLǧς胁ʂ擾܂B
+	/// </summary>
+	size_t GetMemoryUsage() const
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_MemoryUsage;
+	}
+
+	/// <summary>
+	/// w肳ꂽt@C̃LbVj܂B
+	/// </summary>
+	/// <param name="In_FilePath">ΏۂYAMLt@C̃pXB</param>
+	void Invalidate(_In_ const std::string& In_FilePath)
+	{
+		std::error_code ec;
+		const std::string key = std::filesystem::canonical(In_FilePath, ec).string();
+		if (ec) return;
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		auto itr = m_Entries.find(key);
+		if (itr != m_Entries.end()) EraseEntry(itr);
+	}
+
+	/// <summary>
+	/// ׂẴLbVj܂B
+	/// </summary>
+	void Clear()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Entries.clear();
+		m_LRU.clear();
+		m_MemoryUsage = 0;
+	}
+
+private:
+
+	// t@C̓ꐫ𔻒肷
+	struct FileIdentity
+	{
+		uint64_t size = 0;
+		int64_t time = 0;
+		bool operator==(const FileIdentity& In_Other) const noexcept
+		{
+			return size == In_Other.size && time == In_Other.time;
+		}
+	};
+
+	struct Entry
+	{
+		FileIdentity identity;
+		uint64_t generation = 0;				// pX̌ÂGgƋʂ邽߂̐ԍ
+		std::shared_future<Document> document;	// p[X͖
+		std::list<std::string>::iterator lruPos;
+		size_t memory = 0;						// p[XɊm肷錩ς胁
+	};
+
+	YAMLDocumentCache() = default;
+	YAMLDocumentCache(const YAMLDocumentCache&) = delete;
+	YAMLDocumentCache& operator=(const YAMLDocumentCache&) = delete;
+
+	void EraseEntry(_In_ std::unordered_map<std::string, Entry>::iterator In_Itr)
+	{
+		m_MemoryUsage -= In_Itr->second.memory;
+		m_LRU.erase(In_Itr->second.lruPos);
+		m_Entries.erase(In_Itr);
+	}
+
+	void RemoveIfCurrent(_In_ const std::string& In_Key, _In_ const uint64_t& In_Generation)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		auto itr = m_Entries.find(In_Key);
+		if (itr != m_Entries.end() && itr->second.generation == In_Generation) EraseEntry(itr);
+	}
+
+	/// <summary>
+	/// 𒴂ĂԁAłÂgꂽp[Xς݃Ggj܂B߂Ɏgꂽ1͎c܂B
+	/// </summary>
+	void Evict()
+	{
+		auto lruItr = m_LRU.end();
+		while (m_MemoryUsage > m_MemoryLimit && lruItr != m_LRU.begin())
+		{
+			const auto candidate = std::prev(lruItr);
+			if (candidate == m_LRU.begin()) break;
+			auto itr = m_Entries.find(*candidate);
+			if (itr->second.memory == 0)	// p[X̃Gg͑ΏۊO
+			{
+				lruItr = candidate;
+				continue;
+			}
+			EraseEntry(itr);	// lruItr ͍폜vf̎w܂ܗL
+		}
+	}
+
+	mutable std::mutex m_Mutex;
+	std::unordered_map<std::string, Entry> m_Entries;
+	std::list<std::string> m_LRU;	// 擪قǍŋߎgꂽt@C
+	size_t m_MemoryUsage = 0;
+	size_t m_MemoryLimit = SIZE_MAX;
+	uint64_t m_Generation = 0;
+};
@@ -0,0 +1,323 @@
+#pragma once
+
+#include "YAMLParser.hpp"
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+/// <summary>
+/// "---" ŋ؂ꂽ̃hLg܂YAMLt@CAhLgPʂœǂݍ݂܂B
+/// Open ̓t@C擪xăhLg̋EAehLg͕KvɂȂƂɔԍw肵ăp[X܂B
+/// t@CŜɓǂݍ܂Ȃ߁AȃO`̃t@Cꕔ̃hLgoꍇɎg܂B
+/// Open Ƀt@CύXȂłB
+/// </summary>
+class YAMLDocumentStream
+{
+public:
+	// t@C̃hLg̈ʒu(؂̍s܂܂Ȃ)
+	struct DocumentRange
+	{
+		uint64_t offset = 0;
+		uint64_t size = 0;
+	};
+
+	/// <summary>
+	/// w肳ꂽt@C̃hLg̋E܂B
+	/// "---" ̍s͂̎̍sn܂hLgA"..." ̍s͒ÕhLg̏I\܂B
+	/// "--- {a: 1}" ̂悤 "---" ƓsɃRgȊO̓eꍇ́A̓ëʒuhLgn܂܂B
+	/// "---" Ŏn܂Ȃ́ARgƋsȊO܂ޏꍇɌ1̃hLgƂĈ܂Bt@C擪UTF-8BOM͓ǂݔ΂܂B
+	/// </summary>
+	/// <param name="In_FilePath">ǂݍYAMLt@C̃pXB</param>
+	/// <returns>t@Cǂݍ߂ꍇ trueAsꍇ false Ԃ܂B</returns>
+	bool Open(_In_ const std::string& In_FilePath)
+	{
+		m_FilePath.clear();
+		m_Documents.clear();
+		if (In_FilePath.empty()) return false;
+
+		std::ifstream ifs(In_FilePath, std::ios::binary);
+		if (!ifs)
+		{
+			YAMLParser::Log(YAMLParser::LogLevel::Error, "t@CJ܂: " + In_FilePath);
+			return false;
+		}
+		if (!ScanBoundaries(ifs))
+		{
+			YAMLParser::Log(YAMLParser::LogLevel::Error, "t@Cǂݍ݃G[: " + In_FilePath);
+			m_Documents.clear();
+			return false;
+		}
+		m_FilePath = In_FilePath;
+		return true;
+	}
+
+	// hLg̐
+	inline size_t GetDocumentCount() const noexcept { return m_Documents.size(); }
+
+	// w肳ꂽԍ̃hLg̃t@C̈ʒu
+	inline const DocumentRange& GetDocumentRange(_In_ const size_t& In_Index) const { return m_Documents.at(In_Index); }
+
+	/// <summary>
+	/// w肳ꂽԍ̃hLg̃eLXgAp[Xɂ̂܂ܓǂݍ݂܂Bp[XOɓeōi荞ޏꍇɎg܂B
+	/// </summary>
+	/// <param name="In_Index">hLg̔ԍ(0 )B</param>
+	/// <param name="Out_Source">ǂݍ񂾃eLXgB</param>
+	/// <returns>ǂݍ߂ꍇ trueAԍ͈͊O܂͓ǂݍ݂Ɏsꍇ false Ԃ܂B</returns>
+	bool ReadDocumentSource(_In_ const size_t& In_Index, _Out_ std::string& Out_Source) const
+	{
+		if (In_Index >= m_Documents.size()) return false;
+		std::ifstream ifs(m_FilePath, std::ios::binary);
+		return ReadRange(ifs, m_Documents[In_Index], Out_Source);
+	}
+
+	/// <summary>
+	/// w肳ꂽԍ̃hLgǂݍŃp[X܂B̃hLg͓ǂݍ݂܂B
+	/// </summary>
+	/// <param name="In_Index">hLg̔ԍ(0 )B</param>
+	/// <param name="Out_Parser">p[Xʂ󂯎p[T[B</param>
+	/// <returns>p[Xɐꍇ trueAԍ͈͊O܂͎sꍇ false Ԃ܂B</returns>
+	bool ParseDocument(_In_ const size_t& In_Index, _Out_ YAMLParser& Out_Parser) const
+	{
+		std::string source;
+		return ReadDocumentSource(In_Index, source) && Out_Parser.ParseYAMLBuffer(source);
+	}
+
+	/// <summary>
+	/// hLg擪珇1p[XăR[obNɓn܂B
+	/// ɕێ̂1̃hLĝ߁At@C̑傫ɂ炸gp͍ő̃hLgxɎ܂܂B
+	/// </summary>
+	/// <param name="In_Callback">(size_t ԍ, YAMLParser&amp; p[X) 󂯎Aꍇ true Ԃ֐Bp[Xʂ͎̌Ăяoŏ㏑܂B</param>
+	/// <returns>ׂẴhLgǂݍ߂A܂̓R[obNfꍇ trueAǂݍ݂Ɏsꍇ false Ԃ܂B</returns>
+	template <class Callback>
+	bool ForEachDocument(_In_ Callback&& In_Callback) const
+	{
+		std::ifstream ifs(m_FilePath, std::ios::binary);
+		std::string source;
+		YAMLParser parser;
+		for (size_t i = 0; i < m_Documents.size(); ++i)
+		{
+			if (!ReadRange(ifs, m_Documents[i], source) || !parser.ParseYAMLBuffer(source)) return false;
+			if (!In_Callback(i, parser)) break;
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// w肳ꂽԍ̃hLg𕡐̃XbhŕɃp[XAp[Xł̂珇sŃR[obNɓn܂B
+	/// eXbh̓t@CʂɊJAp[T[g񂷂߁AɕێhLg̓Xbh܂łłB
+	/// R[obÑ͕Xbh瓯ɌĂ΂܂BR[obNO𓊂ꍇ͎c̃p[X𒆎~AĂяo֍đo܂B
+	/// </summary>
+	/// <param name="In_Indices">p[XhLg̔ԍB</param>
+	/// <param name="In_Callback">(size_t ԍ, YAMLParser&amp; p[X) 󂯎֐Bp[Xʂ̓[uĎo܂B</param>
+	/// <param name="In_ThreadCount">gpXbhB0 ̏ꍇ̓n[hEFA̕񐔁B</param>
+	/// <returns>ׂẴhLgp[Xłꍇ trueA͈͊O̔ԍǂݍ݁Ep[XɎs(O܂)̂ꍇ false Ԃ܂B</returns>
+	template <class Callback>
+	bool ParseDocuments(_In_ const std::vector<size_t>& In_Indices, _In_ Callback&& In_Callback, _In_ size_t In_ThreadCount = 0) const
+	{
+		if (In_ThreadCount == 0) In_ThreadCount = (std::max)(1u, std::thread::hardware_concurrency());
+		In_ThreadCount = (std::min)(In_ThreadCount, In_Indices.size());
+
+		std::atomic<size_t> next{ 0 };
+		std::atomic<bool> succeeded{ true };
+		std::mutex errorMutex;
+		std::exception_ptr error;
+		const auto worker = [&]()
+			{
+				std::ifstream ifs(m_FilePath, std::ios::binary);
+				std::string source;
+				YAMLParser parser;
+				while (true)
+				{
+					const size_t i = next.fetch_add(1, std::memory_order_relaxed);
+					if (i >= In_Indices.size()) break;
+					const size_t index = In_Indices[i];
+					bool parsed = false;
+					try
+					{
+						parsed = index < m_Documents.size() && ReadRange(ifs, m_Documents[index], source) && parser.ParseYAMLBuffer(source);
+					}
+					catch (const std::exception& e)
+					{
+						// sȂǂœǂݍ߂ȂhLg͎sƂĈAc̃hLg͑
+						YAMLParser::Log(YAMLParser::LogLevel::Error, "hLg " + std::to_string(index) + " ǂݍ߂܂: " + e.what());
+					}
+					if (!parsed)
+					{
+						succeeded = false;
+						continue;
+					}
+					try
+					{
+						In_Callback(index, parser);
+					}
+					catch (...)
+					{
+						std::lock_guard<std::mutex> lock(errorMutex);
+						if (!error) error = std::current_exception();
+						next = In_Indices.size();
+					}
+				}
+			};
+
+		// ĂяõXbh1̃[J[ƂĎg
+		std::vector<std::thread> threads;
+		threads.reserve(In_ThreadCount > 0 ? In_ThreadCount - 1 : 0);
+		for (size_t i = 1; i < In_ThreadCount; ++i)
+			threads.emplace_back(worker);
+		if (In_ThreadCount > 0) worker();
+		for (auto& thread : threads)
+			thread.join();
+
+		if (error) std::rethrow_exception(error);
+		return succeeded;
+	}
+
+private:
+
+	// xɓǂݍރoCg
+	static constexpr size_t ScanBlockSize = 1 << 20;
+	// sŋ؂肩ǂ𔻒肷̂ɕKvȃoCg("---" Ƒ1)
+	static constexpr size_t MarkerLength = 4;
+	// UTF-8BOM
+	static constexpr std::string_view ByteOrderMark = "\xEF\xBB\xBF";
+
+	/// <summary>
+	/// t@C̑傫ǂݍ݁As𒲂ׂăhLg̋EL^܂B
+	/// s̓r memchr ŉs܂œǂݔ΂߁Aep[X͂邩ɍłB
+	/// </summary>
+	bool ScanBoundaries(_Inout_ std::istream& In_Stream)
+	{
+		std::vector<char> buffer(ScanBlockSize + MarkerLength);
+		uint64_t base = 0;		// buffer[0] ̃t@Cʒu
+		size_t filled = 0;
+		size_t pos = 0;
+		bool lineStart = true;	// pos sǂ
+		bool eof = false;
+
+		const auto refill = [&]()
+			{
+				const size_t requested = buffer.size() - filled;
+				In_Stream.read(buffer.data() + filled, static_cast<std::streamsize>(requested));
+				const size_t got = static_cast<size_t>(In_Stream.gcount());
+				filled += got;
+				if (got < requested) eof = true;
+			};
+
+		m_Scan = ScanState{};
+		refill();
+		if (std::string_view(buffer.data(), filled).substr(0, ByteOrderMark.size()) == ByteOrderMark)
+			pos = m_Scan.start = ByteOrderMark.size();
+		while (true)
+		{
+			if (m_Scan.markerLine)
+			{
+				// "---" ɑ󔒂ǂݔ΂Asɓe΂hLgn߂
+				while (pos < filled && (buffer[pos] == ' ' || buffer[pos] == '\t')) ++pos;
+				if (pos >= filled && !eof)
+				{
+					base += filled;
+					filled = pos = 0;
+					refill();
+					continue;
+				}
+				m_Scan.markerLine = false;
+				if (pos < filled && buffer[pos] != '#' && buffer[pos] != '\r' && buffer[pos] != '\n')
+				{
+					m_Scan.start = base + pos;
+					m_Scan.startNext = false;
+					m_Scan.hasContent = true;
+				}
+			}
+
+			if (!lineStart)
+			{
+				const void* newline = std::memchr(buffer.data() + pos, '\n', filled - pos);
+				if (!newline)
+				{
+					if (eof) break;
+					base += filled;
+					filled = pos = 0;
+					refill();
+					continue;
+				}
+				pos = static_cast<size_t>(static_cast<const char*>(newline) - buffer.data()) + 1;
+				lineStart = true;
+			}
+
+			// ɕKvȐǂ݂Ȃ΁As擪ɋl߂ēǂݑ
+			if (filled - pos < MarkerLength && !eof)
+			{
+				std::memmove(buffer.data(), buffer.data() + pos, filled - pos);
+				base += pos;
+				filled -= pos;
+				pos = 0;
+				refill();
+				continue;
+			}
+			if (pos >= filled) break;
+
+			ClassifyLine(std::string_view(buffer.data() + pos, (std::min)(filled - pos, MarkerLength)), base + pos);
+			if (m_Scan.markerLine) pos += 3;
+			lineStart = false;
+		}
+		if (In_Stream.bad()) return false;
+		FinishDocument(base + filled, true);
+		return true;
+	}
+
+	// ̃hLg̏
+	struct ScanState
+	{
+		uint64_t start = 0;			// hLg̊Jnʒu
+		bool isExplicit = false;	// "---" Ŏn܂hLg
+		bool hasContent = false;	// RgƋsȊO̍s
+		bool startNext = false;		// ؂̍s̎̍shLgn܂
+		bool markerLine = false;	// "---" ̒ŁAsɑe܂ׂĂȂ
+	};
+
+	void ClassifyLine(_In_ std::string_view In_Head, _In_ const uint64_t& In_Offset)
+	{
+		if (m_Scan.startNext)
+		{
+			m_Scan.start = In_Offset;
+			m_Scan.startNext = false;
+		}
+
+		const bool marker = In_Head.size() >= 3 && (In_Head.compare(0, 3, "---") == 0 || In_Head.compare(0, 3, "...") == 0) &&
+			(In_Head.size() == 3 || In_Head[3] == ' ' || In_Head[3] == '\t' || In_Head[3] == '\r' || In_Head[3] == '\n');
+		if (marker)
+		{
+			FinishDocument(In_Offset, false);
+			m_Scan.isExplicit = (In_Head[0] == '-');
+			m_Scan.startNext = true;
+			m_Scan.markerLine = m_Scan.isExplicit;
+			return;
+		}
+		const char c = In_Head[0];
+		if (c != '#' && c != '%' && c != ' ' && c != '\t' && c != '\r' && c != '\n') m_Scan.hasContent = true;
+	}
+
+	// ݂̃hLg In_End ŕ
+	void FinishDocument(_In_ const uint64_t& In_End, _In_ const bool& In_EndOfFile)
+	{
+		if (m_Scan.startNext && In_EndOfFile) m_Scan.start = In_End;
+		if (m_Scan.isExplicit || m_Scan.hasContent)
+			m_Documents.push_back({ m_Scan.start, In_End - m_Scan.start });
+		m_Scan = ScanState{};
+	}
+
+	static bool ReadRange(_Inout_ std::istream& In_Stream, _In_ const DocumentRange& In_Range, _Out_ std::string& Out_Source)
+	{
+		Out_Source.resize(static_cast<size_t>(In_Range.size));
+		In_Stream.clear();
+		In_Stream.seekg(static_cast<std::streamoff>(In_Range.offset));
+		In_Stream.read(Out_Source.data(), static_cast<std::streamsize>(Out_Source.size()));
+		return In_Stream && static_cast<uint64_t>(In_Stream.gcount()) == In_Range.size;
+	}
+
+	std::string m_FilePath;
+	std::vector<DocumentRange> m_Documents;
+	ScanState m_Scan;
+};
@@ -0,0 +1,189 @@
+#pragma once
+
+#include "YAMLParser.hpp"
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/// <summary>
+/// YAMLt@C̕ύXĎAobNOEhōăp[XhLgAg~bNɍւ܂B
+/// ǂݎ Current() Ŏ擾hLgbNȂŎgAւÕhLgQƂĂԂ͗LłB
+/// eςꍇ́AǉE폜EύXꂽL[̈ꗗwǎ҂ɒʒm܂B
+/// </summary>
+class YAMLFileWatcher
+{
+public:
+	using Document = std::shared_ptr<const YAMLParser>;
+	using Listener = std::function<void(const Document& In_Document, const std::vector<YAMLParser::YAMLChange>& In_Changes)>;
+
+	YAMLFileWatcher() = default;
+	YAMLFileWatcher(const YAMLFileWatcher&) = delete;
+	YAMLFileWatcher& operator=(const YAMLFileWatcher&) = delete;
+	~YAMLFileWatcher() { Stop(); }
+
+	/// <summary>
+	/// w肳ꂽYAMLt@Cǂݍ݁AύX̊ĎJn܂B
+	/// </summary>
+	/// <param name="In_FilePath">ĎYAMLt@C̃pXB</param>
+	/// <returns>̓ǂݍ݂ƊĎ̊Jnɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	bool Start(_In_ const std::string& In_FilePath)
+	{
+		Stop();
+		if (In_FilePath.empty()) return false;
+
+		m_FilePath = In_FilePath;
+		m_Size = 0;
+		m_Time = 0;
+		if (!Reload()) return false;
+
+		std::filesystem::path dirPath = std::filesystem::path(In_FilePath).parent_path();
+		if (dirPath.empty()) dirPath = ".";
+		m_ChangeHandle = FindFirstChangeNotificationA(dirPath.string().c_str(), FALSE,
+			FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_FILE_NAME);
+		if (m_ChangeHandle == INVALID_HANDLE_VALUE)
+		{
+			YAMLParser::Log(YAMLParser::LogLevel::Error, "t@C̊ĎJnł܂: " + In_FilePath);
+			return false;
+		}
+		m_StopEvent = CreateEventA(NULL, TRUE, FALSE, NULL);
+		if (!m_StopEvent)
+		{
+			FindCloseChangeNotification(m_ChangeHandle);
+			m_ChangeHandle = INVALID_HANDLE_VALUE;
+			return false;
+		}
+		m_Thread = std::thread(&YAMLFileWatcher::WatchLoop, this);
+		return true;
+	}
+
+	/// <summary>
+	/// Ď~܂BŌɓǂݍ񂾃hLg͈擾ł܂B
+	/// </summary>
+	void Stop()
+	{
+		if (!m_Thread.joinable()) return;
+		SetEvent(m_StopEvent);
+		m_Thread.join();
+		FindCloseChangeNotification(m_ChangeHandle);
+		CloseHandle(m_StopEvent);
+		m_ChangeHandle = INVALID_HANDLE_VALUE;
+		m_StopEvent = NULL;
+	}
+
+	/// <summary>
+	/// ݌JĂhLg擾܂BǂݍݑO nullptr Ԃ܂B
+	/// </summary>
+	inline Document Current() const { return std::atomic_load(&m_Current); }
+
+	/// <summary>
+	/// t@C̓eςƂɌĂ΂郊Xi[o^܂BXi[͊ĎXbhĂ΂܂B
+	/// </summary>
+	/// <param name="In_Listener">VhLgƍꗗ󂯎֐B</param>
+	/// <returns>o^ɎgIDԂ܂B</returns>
+	size_t Subscribe(_In_ Listener In_Listener)
+	{
+		std::lock_guard<std::mutex> lock(m_ListenerMutex);
+		m_Listeners.emplace_back(++m_NextListenerId, std::move(In_Listener));
+		return m_NextListenerId;
+	}
+
+	/// <summary>
+	/// o^ς݂̃Xi[܂B
+	/// </summary>
+	/// <param name="In_Id">Subscribe ԂIDB</param>
+	void Unsubscribe(_In_ const size_t& In_Id)
+	{
+		std::lock_guard<std::mutex> lock(m_ListenerMutex);
+		m_Listeners.erase(std::remove_if(m_Listeners.begin(), m_Listeners.end(),
+			[In_Id](const auto& In_Entry) { return In_Entry.first == In_Id; }), m_Listeners.end());
+	}
+
+	/// <summary>
+	/// t@Cɍăp[XA΃hLgւ܂Bsꍇ݂͌̃hLgێ܂B
+	/// </summary>
+	/// <returns>ăp[Xɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	bool Reload()
+	{
+		Document current;
+		std::vector<YAMLParser::YAMLChange> changes;
+		{
+			std::lock_guard<std::mutex> lock(m_ReloadMutex);
+			// p[XɏꂽꍇɎ̕ύXʒmœǂݒ悤Aʏ̓p[XOɎ擾
+			uint64_t size = 0;
+			int64_t time = 0;
+			YAMLParser::GetSourceIdentity(m_FilePath, size, time);
+
+			auto parser = std::make_shared<YAMLParser>();
+			if (!parser->ParseYAML(m_FilePath))
+			{
+				// ʏ͍XVAt@CꂽƂ̕ύXʒmōĂѓǂݍ߂悤ɂ
+				YAMLParser::Log(YAMLParser::LogLevel::Error, "ēǂݍ݂Ɏs߁AȑO̓eێ܂: " + m_FilePath);
+				return false;
+			}
+			m_Size = size;
+			m_Time = time;
+
+			const Document previous = std::atomic_load(&m_Current);
+			current = parser;
+			std::atomic_store(&m_Current, current);
+			if (previous) changes = previous->Diff(*current);
+		}
+		// Xi[ Reload Ăׂ悤Aʒm̓bN̊Oōs
+		if (!changes.empty()) Notify(current, changes);
+		return true;
+	}
+
+private:
+
+	// ݓr̃t@Cǂ܂Ȃ悤AύXʒmēǂݍ݂܂ő҂
+	static constexpr DWORD SettleMilliseconds = 50;
+
+	void WatchLoop()
+	{
+		const HANDLE handles[2] = { m_StopEvent, m_ChangeHandle };
+		while (true)
+		{
+			const DWORD result = WaitForMultipleObjects(2, handles, FALSE, INFINITE);
+			if (result != WAIT_OBJECT_0 + 1) break;	// ~v܂̓G[
+
+			if (WaitForSingleObject(m_StopEvent, SettleMilliseconds) == WAIT_OBJECT_0) break;
+			if (!FindNextChangeNotification(m_ChangeHandle)) break;
+
+			// fBNg̕ʃt@C̕ύXʒm邽߁AΏۃt@CςƂēǂݍ݂
+			uint64_t size = 0;
+			int64_t time = 0;
+			if (!YAMLParser::GetSourceIdentity(m_FilePath, size, time)) continue;
+			{
+				std::lock_guard<std::mutex> lock(m_ReloadMutex);
+				if (size == m_Size && time == m_Time) continue;
+			}
+			Reload();
+		}
+	}
+
+	void Notify(_In_ const Document& In_Document, _In_ const std::vector<YAMLParser::YAMLChange>& In_Changes)
+	{
+		std::vector<std::pair<size_t, Listener>> listeners;
+		{
+			std::lock_guard<std::mutex> lock(m_ListenerMutex);
+			listeners = m_Listeners;
+		}
+		for (const auto& listener : listeners)
+			listener.second(In_Document, In_Changes);
+	}
+
+	std::string m_FilePath;
+	Document m_Current;				// std::atomic_load / std::atomic_store ł̂݃ANZX
+	std::mutex m_ReloadMutex;
+	uint64_t m_Size = 0;			// Ōɓǂݍ񂾎_̃t@CTCY
+	int64_t m_Time = 0;				// Ōɓǂݍ񂾎_̍XV
+
+	std::mutex m_ListenerMutex;
+	std::vector<std::pair<size_t, Listener>> m_Listeners;
+	size_t m_NextListenerId = 0;
+
+	std::thread m_Thread;
+	HANDLE m_ChangeHandle = INVALID_HANDLE_VALUE;
+	HANDLE m_StopEvent = NULL;
+};
@@ -0,0 +1,1057 @@
+#pragma once
+
+#include "YAMLParser.hpp"
+#include <memory>
+#include <unordered_map>
+
+#if defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define YAMLJSON_USE_SSE2
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// YAMLJSON oJSON̏IvVłB
+struct YAMLJSONOptions
+{
+	int indentWidth = 0;	// vfƂɉsĎ镝(0 ͉s󔒂ꂸɏo)
+};
+
+/// <summary>
+/// YAMLJSON𑊌݂ɕϊ܂Bǂ̕p[XCxg𒼐ڕϊ邽߁Am[hc[oR܂B
+/// JSON̕UTF-8œǂݏAp[T[̕R[hƂ̕ϊASCIIȊO̕܂ޕ񂾂ɍs܂B
+/// YAML̃XJ[́Apň͂܂ꂽ̂ƃubNXJ[𕶎AȊO nullE^UlElÊꂩƂďo܂B
+/// </summary>
+class YAMLJSON
+{
+public:
+	/// <summary>
+	/// CxgJSONƂăXg[֏onh[łBParseEventsAEmitEventsAEmitDocumentEvents ̂ɂn܂B
+	/// AJ[tl̃CxgL^ĂAGCAX̉ӏōĐ܂B}[WL[(&lt;&lt;)̎荞݌̗vf́A
+	/// }bvɂ܂oĂȂL[̈ʒuɏo܂B}[W̌ɓL[Ăꍇ͗o߁A
+	/// ɏꂽ̒lg܂(JSON̏dL[͌̒lLɂȂʓIȂ)B
+	/// o͓͂ł܂Ƃ߂Ă珑o܂BoI Flush ĂԂÃnh[jĂB
+	/// </summary>
+	class Emitter
+	{
+	public:
+		/// <param name="Out_OStream">õXg[B</param>
+		/// <param name="In_Options">IvVB</param>
+		explicit Emitter(_Inout_ std::ostream& Out_OStream, _In_ const YAMLJSONOptions& In_Options = YAMLJSONOptions())
+			: m_OStream(Out_OStream), m_Options(In_Options)
+		{
+			m_Buffer.reserve(FlushThreshold + FlushThreshold / 4);
+			m_Frames.reserve(16);
+		}
+		Emitter(const Emitter&) = delete;
+		Emitter& operator=(const Emitter&) = delete;
+		~Emitter() { Flush(); }
+
+		void OnMapStart() { Dispatch(Event{ EventKind::MapStart }); }
+		void OnMapEnd() { Dispatch(Event{ EventKind::MapEnd }); }
+		void OnSeqStart() { Dispatch(Event{ EventKind::SeqStart }); }
+		void OnSeqEnd() { Dispatch(Event{ EventKind::SeqEnd }); }
+		void OnKey(_In_ std::string_view In_Key) { Dispatch(Event{ EventKind::Key, In_Key }); }
+		void OnScalar(_In_ std::string_view In_Value, _In_ YAMLParser::YAMLNode::MultilineType In_MultilineType)
+		{
+			Dispatch(Event{ EventKind::Scalar, In_Value, In_MultilineType });
+		}
+		void OnAnchor(_In_ std::string_view In_Name)
+		{
+			if (m_SkipLevel == 0) m_Recordings.push_back({ std::string(In_Name), m_Frames.size(), std::make_shared<std::vector<RecordedEvent>>() });
+		}
+		void OnAlias(_In_ std::string_view In_Name) { Dispatch(Event{ EventKind::Alias, In_Name }); }
+
+		// ܂Ƃ߂Ăo͂Xg[֏o܂B
+		void Flush()
+		{
+			if (m_Buffer.empty()) return;
+			m_OStream.write(m_Buffer.data(), static_cast<std::streamsize>(m_Buffer.size()));
+			m_Buffer.clear();
+		}
+
+	private:
+		static constexpr size_t FlushThreshold = 64 * 1024;
+
+		enum class EventKind : uint8_t { MapStart, MapEnd, SeqStart, SeqEnd, Key, Scalar, Alias };
+
+		struct Event
+		{
+			EventKind kind;
+			std::string_view text{};
+			YAMLParser::YAMLNode::MultilineType multilineType = YAMLParser::YAMLNode::MultilineType::None;
+		};
+
+		// AJ[̒l̍ĐpɋL^Cxg(L)
+		struct RecordedEvent
+		{
+			EventKind kind;
+			std::string text;
+			YAMLParser::YAMLNode::MultilineType multilineType;
+
+			inline Event View() const noexcept { return Event{ kind, text, multilineType }; }
+		};
+		using Recording = std::shared_ptr<std::vector<RecordedEvent>>;
+
+		// L^̃AJ[̒lBlI m_Frames  depth ɖ߂ƋL^I
+		struct ActiveRecording
+		{
+			std::string name;
+			size_t depth;
+			Recording events;
+		};
+
+		enum class FrameKind : uint8_t
+		{
+			Map,
+			Seq,
+			MergeList,	// }[WL[̒l̃V[PX(oAvfÕ}bv֎荞)
+			MergeMap	// }[WL[̒l̃}bv(oAvfÕ}bv֎荞)
+		};
+
+		struct Frame
+		{
+			FrameKind kind;
+			size_t count = 0;		// ovf̐
+			size_t keysBegin = 0;	// m_Keys ̂̃}bṽL[̊Jnʒu
+		};
+
+		void Dispatch(_In_ const Event& In_Event)
+		{
+			// ĐCxg̓GCAXƂċL^ς
+			if (m_Replaying == 0)
+				for (auto& recording : m_Recordings)
+					recording.events->push_back({ In_Event.kind, std::string(In_Event.text), In_Event.multilineType });
+
+			if (m_SkipLevel > 0)
+			{
+				Skip(In_Event.kind);
+			}
+			else
+			{
+				switch (In_Event.kind)
+				{
+				case EventKind::MapStart: StartMap(); break;
+				case EventKind::SeqStart: StartSeq(); break;
+				case EventKind::MapEnd:
+				case EventKind::SeqEnd: End(); break;
+				case EventKind::Key: WriteKey(In_Event.text); break;
+				case EventKind::Scalar: WriteScalar(In_Event.text, In_Event.multilineType); break;
+				case EventKind::Alias: WriteAlias(In_Event.text); break;
+				}
+			}
+			// GCAX̍ĐɋL^ꂽ܂߁AlIL^m肷
+			while (!m_Recordings.empty() && In_Event.kind != EventKind::Key && m_Frames.size() <= m_Recordings.back().depth)
+			{
+				ActiveRecording& recording = m_Recordings.back();
+				m_Anchors[std::move(recording.name)] = std::move(recording.events);
+				m_Recordings.pop_back();
+			}
+			if (m_Buffer.size() >= FlushThreshold) Flush();
+		}
+
+		// dL[̒lǂݔ΂Bm_SkipLevel  1 l̑ҋ@A2 ȏオRei̓
+		void Skip(_In_ const EventKind& In_Kind)
+		{
+			switch (In_Kind)
+			{
+			case EventKind::MapStart:
+			case EventKind::SeqStart:
+				++m_SkipLevel;
+				break;
+			case EventKind::MapEnd:
+			case EventKind::SeqEnd:
+				if (--m_SkipLevel == 1) m_SkipLevel = 0;
+				break;
+			case EventKind::Scalar:
+			case EventKind::Alias:
+				if (m_SkipLevel == 1) m_SkipLevel = 0;
+				break;
+			case EventKind::Key:
+				break;
+			}
+		}
+
+		void StartMap()
+		{
+			if (TakeMergeValue() || (!m_Frames.empty() && m_Frames.back().kind == FrameKind::MergeList))
+			{
+				m_Frames.push_back({ FrameKind::MergeMap });
+				return;
+			}
+			BeginValue();
+			m_Buffer += '{';
+			m_Frames.push_back({ FrameKind::Map, 0, m_Keys.size() });
+		}
+
+		void StartSeq()
+		{
+			if (TakeMergeValue() || (!m_Frames.empty() && m_Frames.back().kind == FrameKind::MergeList))
+			{
+				m_Frames.push_back({ FrameKind::MergeList });
+				return;
+			}
+			BeginValue();
+			m_Buffer += '[';
+			m_Frames.push_back({ FrameKind::Seq });
+		}
+
+		void End()
+		{
+			if (m_Frames.empty()) return;
+			const Frame frame = m_Frames.back();
+			m_Frames.pop_back();
+			if (frame.kind == FrameKind::MergeList || frame.kind == FrameKind::MergeMap) return;
+			if (frame.kind == FrameKind::Map) m_Keys.resize(frame.keysBegin);
+			if (frame.count > 0) WriteNewLine();
+			m_Buffer += (frame.kind == FrameKind::Map) ? '}' : ']';
+		}
+
+		void WriteKey(_In_ std::string_view In_Key)
+		{
+			Frame* target = KeyTarget();
+			if (!target) return;
+			if (m_Frames.back().kind == FrameKind::Map && In_Key == "<<")
+			{
+				// l荞݌ǂ͎̃CxgŌ܂邽߁AL[̏oۗ
+				m_MergeKey = true;
+				return;
+			}
+			// pň͂܂ꂽL[͈݂͂OƂĈ(d̔)
+			const std::string_view key = YAMLParser::UnquoteScalar(In_Key);
+			// 荞񂾗vf̂AɏoL[͓ǂݔ΂
+			if (m_Frames.back().kind == FrameKind::MergeMap && HasKey(*target, key))
+			{
+				m_SkipLevel = 1;
+				return;
+			}
+			AppendKey(*target, key);
+		}
+
+		void WriteScalar(_In_ std::string_view In_Value, _In_ const YAMLParser::YAMLNode::MultilineType& In_MultilineType)
+		{
+			if (!m_Frames.empty() && m_Frames.back().kind == FrameKind::MergeList) return;
+			if (m_MergeKey)
+			{
+				// 荞݌łȂl͒ʏ̃L[Ƃďo
+				m_MergeKey = false;
+				AppendKey(m_Frames.back(), "<<");
+			}
+			BeginValue();
+			if (In_MultilineType != YAMLParser::YAMLNode::MultilineType::None)
+			{
+				AppendString(In_Value, true);
+				return;
+			}
+			const std::string_view text = TrimSpace(In_Value);
+			if (text.size() >= 2 && (text.front() == '"' || text.front() == '\'') && text.back() == text.front())
+			{
+				const std::string_view body = text.substr(1, text.size() - 2);
+				if (text.front() == '"' && body.find('\\') != std::string_view::npos)
+					AppendString(UnescapeQuoted(body), false);
+				else
+					AppendString(body, true);
+				return;
+			}
+			switch (ClassifyPlain(text))
+			{
+			case PlainKind::Null: m_Buffer += "null"; break;
+			case PlainKind::True: m_Buffer += "true"; break;
+			case PlainKind::False: m_Buffer += "false"; break;
+			case PlainKind::Number: m_Buffer += text; break;
+			case PlainKind::String: AppendString(text, true); break;
+			}
+		}
+
+		void WriteAlias(_In_ std::string_view In_Name)
+		{
+			const auto itr = m_Anchors.find(std::string(In_Name));
+			if (itr == m_Anchors.end())
+			{
+				// eȂ悤AĂƂ̕ƂĎc(m[hc[gݗĂꍇƓ)
+				YAMLParser::Log(YAMLParser::LogLevel::Warning, "GCAXł܂: *" + std::string(In_Name));
+				WriteScalar("\"*" + std::string(In_Name) + "\"", YAMLParser::YAMLNode::MultilineType::None);
+				return;
+			}
+			const Recording events = itr->second;	// ĐɓOtĂێ
+			const bool merge = TakeMergeValue() || (!m_Frames.empty() && m_Frames.back().kind == FrameKind::MergeList);
+			++m_Replaying;
+			if (!merge)
+			{
+				for (const auto& recorded : *events) Dispatch(recorded.View());
+				--m_Replaying;
+				return;
+			}
+			if (events->empty() || events->front().kind != EventKind::MapStart)
+			{
+				YAMLParser::Log(YAMLParser::LogLevel::Warning, "}[WL[̒l}bvł͂܂: *" + std::string(In_Name));
+				--m_Replaying;
+				return;
+			}
+			// 荞݌̃}bv̗vfA荞ݗp̃t[̒ōĐ
+			m_Frames.push_back({ FrameKind::MergeMap });
+			for (size_t i = 1; i + 1 < events->size(); ++i) Dispatch((*events)[i].View());
+			m_Frames.pop_back();
+			--m_Replaying;
+		}
+
+		// ۗĂ}[WL[̒lB荞݌ƂĈꍇ true
+		bool TakeMergeValue() noexcept
+		{
+			const bool merge = m_MergeKey;
+			m_MergeKey = false;
+			return merge;
+		}
+
+		// L[õ}bv(荞ݗp̃t[̊O)
+		Frame* KeyTarget() noexcept
+		{
+			for (auto itr = m_Frames.rbegin(); itr != m_Frames.rend(); ++itr)
+			{
+				if (itr->kind == FrameKind::Map) return &*itr;
+				if (itr->kind == FrameKind::Seq) return nullptr;
+			}
+			return nullptr;
+		}
+
+		bool HasKey(_In_ const Frame& In_Map, _In_ std::string_view In_Key) const noexcept
+		{
+			size_t pos = In_Map.keysBegin;
+			while (pos < m_Keys.size())
+			{
+				const size_t end = m_Keys.find('\0', pos);
+				if (std::string_view(m_Keys).substr(pos, end - pos) == In_Key) return true;
+				pos = end + 1;
+			}
+			return false;
+		}
+
+		void AppendKey(_Inout_ Frame& In_Map, _In_ std::string_view In_Key)
+		{
+			if (In_Map.count++ > 0) m_Buffer += ',';
+			WriteNewLine();
+			AppendString(In_Key, true);
+			m_Buffer += (m_Options.indentWidth > 0) ? ": " : ":";
+			// }[Wŏd邽߁AJĂ}bṽL[L^
+			m_Keys += In_Key;
+			m_Keys += '\0';
+			m_ValuePending = true;
+		}
+
+		// loŐ؂B}bv̒l AppendKey ŋ؂ς
+		void BeginValue()
+		{
+			if (m_ValuePending)
+			{
+				m_ValuePending = false;
+				return;
+			}
+			if (m_Frames.empty()) return;
+			Frame& frame = m_Frames.back();
+			if (frame.count++ > 0) m_Buffer += ',';
+			WriteNewLine();
+		}
+
+		// õRei̐[(荞ݗp̃t[)
+		size_t Level() const noexcept
+		{
+			size_t level = 0;
+			for (const auto& frame : m_Frames)
+				if (frame.kind == FrameKind::Map || frame.kind == FrameKind::Seq) ++level;
+			return level;
+		}
+
+		// ꍇ͉sAõRei̐[܂Ŏ
+		void WriteNewLine()
+		{
+			if (m_Options.indentWidth <= 0) return;
+			m_Buffer += '\n';
+			m_Buffer.append(Level() * static_cast<size_t>(m_Options.indentWidth), ' ');
+		}
+
+		// pň͂ŏoBIn_IsInternal  true ̏ꍇ̓p[T[̕R[hƂUTF-8֕ϊ
+		void AppendString(_In_ std::string_view In_Text, _In_ const bool& In_IsInternal)
+		{
+			const size_t start = m_Buffer.size();
+			m_Buffer += '"';
+			const char* pos = In_Text.data();
+			const char* const end = pos + In_Text.size();
+			const char* run = pos;
+			while ((pos = FindSpecial(pos, end)) != end)
+			{
+				const unsigned char c = static_cast<unsigned char>(*pos);
+				if (c >= 0x80)
+				{
+					if (In_IsInternal)
+					{
+						// ASCIIȊO܂ޕ͑ŜϊĂ珑o(2oCgڂ '\\' ̕邽)
+						m_Buffer.resize(start);
+						AppendString(YAMLParser::ConvertToUTF8(In_Text), false);
+						return;
+					}
+					++pos;
+					continue;
+				}
+				m_Buffer.append(run, pos);
+				AppendEscaped(c);
+				run = ++pos;
+			}
+			m_Buffer.append(run, end);
+			m_Buffer += '"';
+		}
+
+		void AppendEscaped(_In_ const unsigned char& In_Char)
+		{
+			static constexpr char Hex[] = "0123456789abcdef";
+			switch (In_Char)
+			{
+			case '"': m_Buffer += "\\\""; break;
+			case '\\': m_Buffer += "\\\\"; break;
+			case '\b': m_Buffer += "\\b"; break;
+			case '\f': m_Buffer += "\\f"; break;
+			case '\n': m_Buffer += "\\n"; break;
+			case '\r': m_Buffer += "\\r"; break;
+			case '\t': m_Buffer += "\\t"; break;
+			default:
+				m_Buffer += "\\u00";
+				m_Buffer += Hex[In_Char >> 4];
+				m_Buffer += Hex[In_Char & 0xF];
+				break;
+			}
+		}
+
+		std::ostream& m_OStream;
+		YAMLJSONOptions m_Options;
+		std::string m_Buffer;					// Xg[֏oȌo
+		std::vector<Frame> m_Frames;
+		std::string m_Keys;						// JĂ}bvɏoL[('\0' ؂)
+		bool m_ValuePending = false;			// L[oAl҂Ă
+		bool m_MergeKey = false;				// }[WL[(<<)̒l҂Ă
+		size_t m_SkipLevel = 0;					// ǂݔ΂̒l̃lXg(0 ͓ǂݔ΂ĂȂ)
+		size_t m_Replaying = 0;					// GCAX̒lĐ̃lXg
+		std::vector<ActiveRecording> m_Recordings;
+		std::unordered_map<std::string, Recording> m_Anchors;	// AJ[L^l
+	};
+
+	/// <summary>
+	/// YAMLt@Cm[hc[\zJSONt@C֕ϊ܂B
+	/// </summary>
+	/// <param name="In_YAMLPath">ǂݍYAMLt@C̃pXB</param>
+	/// <param name="In_JSONPath">oJSONt@C̃pXB</param>
+	/// <param name="In_Options">IvVB</param>
+	/// <param name="In_Limits">p[X̏B</param>
+	/// <returns>ϊɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	static bool ConvertYAMLToJSON(_In_ const std::string& In_YAMLPath, _In_ const std::string& In_JSONPath,
+		_In_ const YAMLJSONOptions& In_Options = YAMLJSONOptions(), _In_ const YAMLParser::YAMLParseLimits& In_Limits = YAMLParser::YAMLParseLimits())
+	{
+		std::ofstream ofs;
+		if (!YAMLParser::OpenOutputFile(In_JSONPath, ofs)) return false;
+		{
+			Emitter emitter(ofs, In_Options);
+			if (!YAMLParser::ParseEvents(In_YAMLPath, emitter, In_Limits)) return false;
+		}
+		return CheckWritten(ofs, In_JSONPath);
+	}
+
+	/// <summary>
+	/// p[T[ێYAMLf[^JSONt@CƂĕۑ܂B}bv̗vf̓nbVɏo܂B
+	/// </summary>
+	/// <param name="In_Parser">ۑYAMLf[^p[T[B</param>
+	/// <param name="In_FilePath">oJSONt@C̃pXB</param>
+	/// <param name="In_Options">IvVB</param>
+	/// <returns>ۑɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	static bool SaveJSON(_In_ const YAMLParser& In_Parser, _In_ const std::string& In_FilePath, _In_ const YAMLJSONOptions& In_Options = YAMLJSONOptions())
+	{
+		std::ofstream ofs;
+		if (!YAMLParser::OpenOutputFile(In_FilePath, ofs)) return false;
+		{
+			Emitter emitter(ofs, In_Options);
+			YAMLParser::EmitEvents(In_Parser.GetRootNode(), emitter);
+		}
+		return CheckWritten(ofs, In_FilePath);
+	}
+
+	/// <summary>
+	/// UTF-8JSONeLXgp[XA\CxgƂănh[ɒʒm܂Bʒm镶̓p[T[̕R[hłB
+	/// lE^UlEnull ʂ̍\ƕ镶͈pň͂Œʒm܂Bł YAMLEmitter Ȃǂł̂܂܏o悤A
+	/// dp̒ '"'A'\\'AsȂǂ̐䕶GXP[v܂(s܂ޕubNXJ[ɂ͂܂)B
+	/// </summary>
+	/// <param name="In_Source">p[XJSONeLXgB</param>
+	/// <param name="In_Handler">Cxg󂯎nh[(YAMLParser::YAMLEventHandler Q)B</param>
+	/// <param name="In_Limits">p[X̏B</param>
+	/// <param name="In_EscapeStrings">false ̏ꍇAm[hc[gݗĂꍇ̂߂ɃGXP[vAUnquoteScalar Ō̕ɖ߂\LŒʒm܂
+	/// (s܂ޕ̓e`ɂ܂)B</param>
+	/// <returns>p[Xɐꍇ trueA\G[܂͏𒴂ꍇ false Ԃ܂B</returns>
+	template <class Handler>
+	static bool ParseJSONEvents(_In_ std::string_view In_Source, _Inout_ Handler&& In_Handler,
+		_In_ const YAMLParser::YAMLParseLimits& In_Limits = YAMLParser::YAMLParseLimits(), _In_ const bool& In_EscapeStrings = true)
+	{
+		if (In_Source.size() >= 3 && In_Source.compare(0, 3, "\xEF\xBB\xBF") == 0) In_Source.remove_prefix(3);
+
+		enum class State { Value, Key, AfterValue };
+		std::string closers;	// JĂRei̕
+		std::string scratch, converted, quoted;
+		size_t nodes = 0;
+		size_t pos = SkipSpace(In_Source, 0);
+		State state = State::Value;
+		while (true)
+		{
+			if (state == State::AfterValue)
+			{
+				pos = SkipSpace(In_Source, pos);
+				if (closers.empty()) break;
+				if (pos >= In_Source.size()) return FailJSON(In_Source, pos, "ʂ܂");
+				const char c = In_Source[pos++];
+				if (c == ',')
+				{
+					pos = SkipSpace(In_Source, pos);
+					state = (closers.back() == '}') ? State::Key : State::Value;
+				}
+				else if (c == closers.back())
+				{
+					closers.pop_back();
+					if (c == '}') In_Handler.OnMapEnd();
+					else In_Handler.OnSeqEnd();
+				}
+				else
+				{
+					return FailJSON(In_Source, pos - 1, "',' ܂͕ʂKvł");
+				}
+				continue;
+			}
+			if (state == State::Key)
+			{
+				std::string_view key;
+				if (pos >= In_Source.size() || In_Source[pos] != '"') return FailJSON(In_Source, pos, "L[̕񂪕Kvł");
+				if (!ReadString(In_Source, ++pos, In_Limits, scratch, converted, key)) return false;
+				pos = SkipSpace(In_Source, pos);
+				if (pos >= In_Source.size() || In_Source[pos] != ':') return FailJSON(In_Source, pos, "':' Kvł");
+				pos = SkipSpace(In_Source, pos + 1);
+				In_Handler.OnKey(key);
+				state = State::Value;
+				continue;
+			}
+
+			if (pos >= In_Source.size()) return FailJSON(In_Source, pos, "l܂");
+			if (In_Limits.maxNodes != 0 && ++nodes > In_Limits.maxNodes)
+				return FailJSON(In_Source, pos, "m[h̐(" + std::to_string(In_Limits.maxNodes) + ")𒴂܂");
+			const char c = In_Source[pos];
+			if (c == '{' || c == '[')
+			{
+				if (In_Limits.maxDepth != 0 && closers.size() >= In_Limits.maxDepth)
+					return FailJSON(In_Source, pos, "lXg̐[(" + std::to_string(In_Limits.maxDepth) + ")𒴂܂");
+				const char closer = (c == '{') ? '}' : ']';
+				if (c == '{') In_Handler.OnMapStart();
+				else In_Handler.OnSeqStart();
+				pos = SkipSpace(In_Source, pos + 1);
+				if (pos < In_Source.size() && In_Source[pos] == closer)
+				{
+					++pos;
+					if (c == '{') In_Handler.OnMapEnd();
+					else In_Handler.OnSeqEnd();
+					state = State::AfterValue;
+					continue;
+				}
+				closers += closer;
+				state = (c == '{') ? State::Key : State::Value;
+				continue;
+			}
+			if (c == '"')
+			{
+				std::string_view text;
+				if (!ReadString(In_Source, ++pos, In_Limits, scratch, converted, text)) return false;
+				if (!In_EscapeStrings && text.find('\n') != std::string_view::npos)
+				{
+					In_Handler.OnScalar(text, YAMLParser::YAMLNode::MultilineType::Literal);
+				}
+				else if (text.empty() || ClassifyPlain(text) != PlainKind::String || NeedsQuote(text) || text != YAMLParser::UnquoteScalar(text))
+				{
+					// ̂܂ܒʒmƕȊOƂāA܂͕ʂ̕\Ƃēǂݖ߂邽߈pň͂
+					if (In_EscapeStrings)
+					{
+						QuoteScalar(text, quoted);
+					}
+					else
+					{
+						quoted.assign(1, '"');
+						quoted += text;
+						quoted += '"';
+					}
+					In_Handler.OnScalar(quoted, YAMLParser::YAMLNode::MultilineType::None);
+				}
+				else
+				{
+					In_Handler.OnScalar(text, YAMLParser::YAMLNode::MultilineType::None);
+				}
+				state = State::AfterValue;
+				continue;
+			}
+			// lE^UlEnull ͂̂܂܂̕\LŒʒm
+			size_t end = pos;
+			while (end < In_Source.size() && (std::isalnum(static_cast<unsigned char>(In_Source[end])) ||
+				In_Source[end] == '-' || In_Source[end] == '+' || In_Source[end] == '.')) ++end;
+			const std::string_view token = In_Source.substr(pos, end - pos);
+			if (token != "true" && token != "false" && token != "null" && !IsJSONNumber(token))
+				return FailJSON(In_Source, pos, "sȒlł");
+			In_Handler.OnScalar(token, YAMLParser::YAMLNode::MultilineType::None);
+			pos = end;
+			state = State::AfterValue;
+		}
+		if (pos != In_Source.size()) return FailJSON(In_Source, pos, "ľɗ]ȕ܂");
+		return true;
+	}
+
+	/// <summary>
+	/// UTF-8JSONeLXgp[XAp[T[YAMLf[^Ƃĕێ܂Bŏʂ̓IuWFNgłKv܂B
+	/// p[T[ɐݒ肳ꂽ(SetParseLimits)Kp܂B
+	/// </summary>
+	/// <param name="In_Source">p[XJSONeLXgB</param>
+	/// <param name="Out_Parser">p[Xʂ󂯎p[T[Bsꍇ͈ȑOYAMLf[^ێ܂B</param>
+	/// <returns>p[Xɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	static bool ParseJSONBuffer(_In_ std::string_view In_Source, _Inout_ YAMLParser& Out_Parser)
+	{
+		const YAMLParser::YAMLParseLimits limits = Out_Parser.GetParseLimits();
+		if (limits.maxTotalBytes != 0 && In_Source.size() > limits.maxTotalBytes)
+		{
+			YAMLParser::Log(YAMLParser::LogLevel::Error, "͂̑傫(" + std::to_string(limits.maxTotalBytes) + "oCg)𒴂Ă܂");
+			return false;
+		}
+		return Out_Parser.LoadEvents([&](auto& In_Builder) { return ParseJSONEvents(In_Source, In_Builder, limits, false); });
+	}
+
+	/// <summary>
+	/// JSONt@Cǂݍ݁Ap[T[YAMLf[^Ƃĕێ܂BParseJSONBuffer QƂĂB
+	/// </summary>
+	/// <param name="In_FilePath">ǂݍJSONt@C̃pXB</param>
+	/// <param name="Out_Parser">p[Xʂ󂯎p[T[B</param>
+	/// <returns>p[Xɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	static bool ParseJSON(_In_ const std::string& In_FilePath, _Inout_ YAMLParser& Out_Parser)
+	{
+		std::string source;
+		return ReadFile(In_FilePath, source) && ParseJSONBuffer(source, Out_Parser);
+	}
+
+	/// <summary>
+	/// JSONt@Cm[hc[\zYAMLt@C֕ϊ܂BoR[h SaveYAML ƓłB
+	/// ParseJSON Ɠŏʂ̓IuWFNgłKvAȊȌꍇ̓t@Co܂B
+	/// </summary>
+	/// <param name="In_JSONPath">ǂݍJSONt@C̃pXB</param>
+	/// <param name="In_YAMLPath">oYAMLt@C̃pXB</param>
+	/// <param name="In_Options">YAML̏IvVB</param>
+	/// <returns>ϊɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	static bool ConvertJSONToYAML(_In_ const std::string& In_JSONPath, _In_ const std::string& In_YAMLPath,
+		_In_ const YAMLParser::YAMLSaveOptions& In_Options = YAMLParser::YAMLSaveOptions())
+	{
+		std::string source;
+		if (!ReadFile(In_JSONPath, source)) return false;
+		std::string_view body = source;
+		if (body.size() >= 3 && body.compare(0, 3, "\xEF\xBB\xBF") == 0) body.remove_prefix(3);
+		const size_t first = SkipSpace(body, 0);
+		if (first >= body.size() || body[first] != '{')
+		{
+			YAMLParser::Log(YAMLParser::LogLevel::Error, "ŏʂIuWFNgJSONł͂܂: " + In_JSONPath);
+			return false;
+		}
+		std::ofstream ofs;
+		if (!YAMLParser::OpenOutputFile(In_YAMLPath, ofs)) return false;
+		if (!ParseJSONEvents(source, YAMLParser::YAMLEmitter(ofs, In_Options))) return false;
+		return CheckWritten(ofs, In_YAMLPath);
+	}
+
+private:
+	enum class PlainKind { Null, True, False, Number, String };
+
+	// p̂ȂXJ[JSON̂ǂ̒lƂďo
+	static PlainKind ClassifyPlain(_In_ std::string_view In_Text) noexcept
+	{
+		if (In_Text.empty()) return PlainKind::Null;
+		// 唼̃XJ[͐擪̕Ŕł
+		switch (In_Text.front())
+		{
+		case '-': case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
+			return IsJSONNumber(In_Text) ? PlainKind::Number : PlainKind::String;
+		case '~': case 'n': case 'N':
+			return (In_Text == "~" || In_Text == "null" || In_Text == "Null" || In_Text == "NULL") ? PlainKind::Null : PlainKind::String;
+		case 't': case 'T':
+			return (In_Text == "true" || In_Text == "True" || In_Text == "TRUE") ? PlainKind::True : PlainKind::String;
+		case 'f': case 'F':
+			return (In_Text == "false" || In_Text == "False" || In_Text == "FALSE") ? PlainKind::False : PlainKind::String;
+		default:
+			return PlainKind::String;
+		}
+	}
+
+	// pň͂܂Ȃƕʂ̒l\Ƃēǂ܂镶(YAMLParser::NeedsQuotes ɉAGXP[vKvȐ䕶܂ނ)
+	static bool NeedsQuote(_In_ std::string_view In_Text) noexcept
+	{
+		if (YAMLParser::NeedsQuotes(In_Text)) return true;
+		for (const char c : In_Text)
+			if (static_cast<unsigned char>(c) < 0x20) return true;
+		return false;
+	}
+
+	/// <summary>
+	/// dp̃XJ[ɂ܂B'"'A'\\'AsȂǂ̐䕶̓GXP[v܂B
+	/// VtgJIS2oCgڂ '\\' ̕ăGXP[vȂ悤AASCIIȊO܂ޏꍇUTF-8őgݗĂĂ߂܂B
+	/// </summary>
+	static void QuoteScalar(_In_ std::string_view In_Text, _Out_ std::string& Out_Quoted)
+	{
+		static constexpr char Hex[] = "0123456789abcdef";
+		const bool ascii = std::all_of(In_Text.begin(), In_Text.end(), [](const char In_Char) { return static_cast<unsigned char>(In_Char) < 0x80; });
+		const std::string utf8 = ascii ? std::string() : YAMLParser::ConvertToUTF8(In_Text);
+		const std::string_view source = ascii ? In_Text : std::string_view(utf8);
+		std::string quoted;
+		quoted.reserve(source.size() + 2);
+		quoted += '"';
+		for (const char c : source)
+		{
+			switch (c)
+			{
+			case '"': quoted += "\\\""; break;
+			case '\\': quoted += "\\\\"; break;
+			case '\n': quoted += "\\n"; break;
+			case '\r': quoted += "\\r"; break;
+			case '\t': quoted += "\\t"; break;
+			default:
+				if (static_cast<unsigned char>(c) < 0x20)
+				{
+					quoted += "\\x";
+					quoted += Hex[static_cast<unsigned char>(c) >> 4];
+					quoted += Hex[c & 0xF];
+				}
+				else
+				{
+					quoted += c;
+				}
+				break;
+			}
+		}
+		quoted += '"';
+		Out_Quoted = ascii ? std::move(quoted) : YAMLParser::ConvertFromUTF8(quoted);
+	}
+
+	/// <summary>
+	/// dp̃XJ[̒g̃GXP[v߂AUTF-8̕ƂĕԂ܂B
+	/// \xA\u(TQ[gyA܂)A\U ̃R[h|CgUTF-8ɂ܂BmȂGXP[vsȃR[h|Cg͂̂܂܎c܂B
+	/// </summary>
+	static std::string UnescapeQuoted(_In_ std::string_view In_Body)
+	{
+		const std::string source = YAMLParser::ConvertToUTF8(In_Body);
+		std::string text;
+		text.reserve(source.size());
+		for (size_t i = 0; i < source.size(); ++i)
+		{
+			if (source[i] != '\\' || i + 1 >= source.size())
+			{
+				text += source[i];
+				continue;
+			}
+			const char e = source[++i];
+			switch (e)
+			{
+			case '"': case '\\': case '/': text += e; break;
+			case '0': text += '\0'; break;
+			case 'b': text += '\b'; break;
+			case 'f': text += '\f'; break;
+			case 'n': text += '\n'; break;
+			case 'r': text += '\r'; break;
+			case 't': text += '\t'; break;
+			case 'x':
+			{
+				uint32_t code = 0;
+				size_t digits = 0;
+				for (; digits < 2 && i + 1 + digits < source.size() && std::isxdigit(static_cast<unsigned char>(source[i + 1 + digits])); ++digits)
+				{
+					const char h = source[i + 1 + digits];
+					code = code * 16 + static_cast<uint32_t>((h <= '9') ? h - '0' : (h | 0x20) - 'a' + 10);
+				}
+				if (digits == 2)
+				{
+					AppendUTF8(text, code);
+					i += 2;
+					break;
+				}
+				text += '\\';
+				text += e;
+				break;
+			}
+			case 'u':
+			case 'U':
+			{
+				const char* const first = source.data() + i + 1;
+				const char* const last = source.data() + source.size();
+				uint32_t code = 0;
+				uint32_t low = 0;
+				size_t length = 4;
+				bool valid = ReadHex4(first, last, code);
+				if (valid && e == 'U')
+				{
+					valid = last - first >= 8 && ReadHex4(first + 4, last, low);
+					code = (code << 16) | low;
+					length = 8;
+				}
+				else if (valid && code >= 0xD800 && code <= 0xDBFF)
+				{
+					// TQ[gyA
+					valid = last - first >= 10 && first[4] == '\\' && first[5] == 'u' && ReadHex4(first + 6, last, low) && low >= 0xDC00 && low <= 0xDFFF;
+					code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+					length = 10;
+				}
+				if (valid && code <= 0x10FFFF && (code < 0xD800 || code > 0xDFFF))
+				{
+					AppendUTF8(text, code);
+					i += length;
+					break;
+				}
+				text += '\\';
+				text += e;
+				break;
+			}
+			default:
+				text += '\\';
+				text += e;
+				break;
+			}
+		}
+		return text;
+	}
+
+	// JSON̐l̕@(-?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?)ɍ
+	static bool IsJSONNumber(_In_ std::string_view In_Text) noexcept
+	{
+		const auto isDigit = [](const char In_Char) { return In_Char >= '0' && In_Char <= '9'; };
+		size_t i = 0;
+		const size_t size = In_Text.size();
+		if (i < size && In_Text[i] == '-') ++i;
+		if (i >= size || !isDigit(In_Text[i])) return false;
+		if (In_Text[i++] != '0') while (i < size && isDigit(In_Text[i])) ++i;
+		if (i < size && In_Text[i] == '.')
+		{
+			if (++i >= size || !isDigit(In_Text[i])) return false;
+			while (i < size && isDigit(In_Text[i])) ++i;
+		}
+		if (i < size && (In_Text[i] == 'e' || In_Text[i] == 'E'))
+		{
+			if (++i < size && (In_Text[i] == '+' || In_Text[i] == '-')) ++i;
+			if (i >= size || !isDigit(In_Text[i])) return false;
+			while (i < size && isDigit(In_Text[i])) ++i;
+		}
+		return i == size;
+	}
+
+	static inline std::string_view TrimSpace(_In_ std::string_view In_Text) noexcept
+	{
+		const auto isSpace = [](const char In_Char) { return In_Char == ' ' || In_Char == '\t' || In_Char == '\r' || In_Char == '\n'; };
+		if (In_Text.empty() || (!isSpace(In_Text.front()) && !isSpace(In_Text.back()))) return In_Text;
+		const size_t first = In_Text.find_first_not_of(" \t\r\n");
+		if (first == std::string_view::npos) return std::string_view();
+		return In_Text.substr(first, In_Text.find_last_not_of(" \t\r\n") - first + 1);
+	}
+
+	/// <summary>
+	/// 񒆂œʂȈKvȍŏ̕('"'A'\\'A䕶AASCIIȊO)T܂B
+	/// SSE2 gꍇ16oCgrAY镶̂ȂubNǂݔ΂܂B
+	/// </summary>
+	/// <returns>ʒuԂ܂BȂꍇ In_Last Ԃ܂B</returns>
+	static inline const char* FindSpecial(_In_ const char* In_First, _In_ const char* In_Last) noexcept
+	{
+#if defined(YAMLJSON_USE_SSE2)
+		const __m128i quote = _mm_set1_epi8('"');
+		const __m128i backslash = _mm_set1_epi8('\\');
+		const __m128i space = _mm_set1_epi8(0x20);
+		while (In_Last - In_First >= 16)
+		{
+			const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(In_First));
+			// t̔r̂߁A0x20  0x80 ȏ̗^ɂȂ
+			const __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)),
+				_mm_cmplt_epi8(chunk, space));
+			const unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(special));
+			if (mask != 0) return In_First + CountTrailingZeros(mask);
+			In_First += 16;
+		}
+#endif
+		for (; In_First != In_Last; ++In_First)
+		{
+			const unsigned char c = static_cast<unsigned char>(*In_First);
+			if (c == '"' || c == '\\' || c < 0x20 || c >= 0x80) break;
+		}
+		return In_First;
+	}
+
+#if defined(YAMLJSON_USE_SSE2)
+	static inline unsigned int CountTrailingZeros(_In_ const unsigned int& In_Mask) noexcept
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, In_Mask);
+		return static_cast<unsigned int>(index);
+#else
+		return static_cast<unsigned int>(__builtin_ctz(In_Mask));
+#endif
+	}
+#endif
+
+	static inline size_t SkipSpace(_In_ std::string_view In_Source, size_t In_Pos) noexcept
+	{
+		while (In_Pos < In_Source.size() &&
+			(In_Source[In_Pos] == ' ' || In_Source[In_Pos] == '\n' || In_Source[In_Pos] == '\r' || In_Source[In_Pos] == '\t')) ++In_Pos;
+		return In_Pos;
+	}
+
+	/// <summary>
+	/// Jn '"' ̎當ǂ݁AI '"' ̎֐i߂܂B
+	/// GXP[v܂܂ȂASCII̕ In_Source 𒼐ڎQƂAȊO͍Ɨp̕ɑgݗĂē̕R[h֕ϊ܂B
+	/// </summary>
+	static bool ReadString(_In_ std::string_view In_Source, _Inout_ size_t& In_Pos, _In_ const YAMLParser::YAMLParseLimits& In_Limits,
+		_Inout_ std::string& Out_Scratch, _Inout_ std::string& Out_Converted, _Out_ std::string_view& Out_Text)
+	{
+		const char* const first = In_Source.data() + In_Pos;
+		const char* const last = In_Source.data() + In_Source.size();
+		const char* pos = first;
+		bool ascii = true;
+		bool escaped = false;
+		Out_Scratch.clear();
+		while (true)
+		{
+			const char* const special = FindSpecial(pos, last);
+			if (special == last) return FailJSON(In_Source, In_Pos - 1, "񂪕Ă܂");
+			const unsigned char c = static_cast<unsigned char>(*special);
+			if (escaped) Out_Scratch.append(pos, special);
+			pos = special + 1;
+			if (c >= 0x80)
+			{
+				ascii = false;
+				if (escaped) Out_Scratch += static_cast<char>(c);
+				continue;
+			}
+			if (c == '"') break;
+			if (c < 0x20) return FailJSON(In_Source, static_cast<size_t>(special - In_Source.data()), "ɐ䕶܂");
+
+			// GXP[vBȍ~͍Ɨp̕ɑgݗĂ
+			if (!escaped)
+			{
+				Out_Scratch.assign(first, special);
+				escaped = true;
+			}
+			if (pos >= last) return FailJSON(In_Source, In_Pos - 1, "񂪕Ă܂");
+			const char e = *pos++;
+			switch (e)
+			{
+			case '"': Out_Scratch += '"'; break;
+			case '\\': Out_Scratch += '\\'; break;
+			case '/': Out_Scratch += '/'; break;
+			case 'b': Out_Scratch += '\b'; break;
+			case 'f': Out_Scratch += '\f'; break;
+			case 'n': Out_Scratch += '\n'; break;
+			case 'r': Out_Scratch += '\r'; break;
+			case 't': Out_Scratch += '\t'; break;
+			case 'u':
+			{
+				uint32_t code;
+				if (!ReadHex4(pos, last, code)) return FailJSON(In_Source, static_cast<size_t>(pos - In_Source.data()), "s \\u GXP[vł");
+				pos += 4;
+				// TQ[gyA
+				if (code >= 0xD800 && code <= 0xDBFF && last - pos >= 6 && pos[0] == '\\' && pos[1] == 'u')
+				{
+					uint32_t low;
+					if (ReadHex4(pos + 2, last, low) && low >= 0xDC00 && low <= 0xDFFF)
+					{
+						code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+						pos += 6;
+					}
+				}
+				if (code >= 0x80) ascii = false;
+				AppendUTF8(Out_Scratch, code);
+				break;
+			}
+			default:
+				return FailJSON(In_Source, static_cast<size_t>(pos - 1 - In_Source.data()), "sȃGXP[vł");
+			}
+		}
+		In_Pos = static_cast<size_t>(pos - In_Source.data());
+		Out_Text = escaped ? std::string_view(Out_Scratch) : std::string_view(first, static_cast<size_t>(pos - 1 - first));
+		if (In_Limits.maxScalarLength != 0 && Out_Text.size() > In_Limits.maxScalarLength)
+			return FailJSON(In_Source, static_cast<size_t>(first - In_Source.data()), "XJ[̒(" + std::to_string(In_Limits.maxScalarLength) + "oCg)𒴂܂");
+		if (!ascii)
+		{
+			Out_Converted = YAMLParser::ConvertFromUTF8(Out_Text);
+			Out_Text = Out_Converted;
+		}
+		return true;
+	}
+
+	static bool ReadHex4(_In_ const char* In_First, _In_ const char* In_Last, _Out_ uint32_t& Out_Code) noexcept
+	{
+		Out_Code = 0;
+		if (In_Last - In_First < 4) return false;
+		for (int i = 0; i < 4; ++i)
+		{
+			const char c = In_First[i];
+			Out_Code <<= 4;
+			if (c >= '0' && c <= '9') Out_Code |= static_cast<uint32_t>(c - '0');
+			else if (c >= 'a' && c <= 'f') Out_Code |= static_cast<uint32_t>(c - 'a' + 10);
+			else if (c >= 'A' && c <= 'F') Out_Code |= static_cast<uint32_t>(c - 'A' + 10);
+			else return false;
+		}
+		return true;
+	}
+
+	static void AppendUTF8(_Inout_ std::string& Out_Text, _In_ const uint32_t& In_Code)
+	{
+		if (In_Code < 0x80)
+		{
+			Out_Text += static_cast<char>(In_Code);
+		}
+		else if (In_Code < 0x800)
+		{
+			Out_Text += static_cast<char>(0xC0 | (In_Code >> 6));
+			Out_Text += static_cast<char>(0x80 | (In_Code & 0x3F));
+		}
+		else if (In_Code < 0x10000)
+		{
+			Out_Text += static_cast<char>(0xE0 | (In_Code >> 12));
+			Out_Text += static_cast<char>(0x80 | ((In_Code >> 6) & 0x3F));
+			Out_Text += static_cast<char>(0x80 | (In_Code & 0x3F));
+		}
+		else
+		{
+			Out_Text += static_cast<char>(0xF0 | (In_Code >> 18));
+			Out_Text += static_cast<char>(0x80 | ((In_Code >> 12) & 0x3F));
+			Out_Text += static_cast<char>(0x80 | ((In_Code >> 6) & 0x3F));
+			Out_Text += static_cast<char>(0x80 | (In_Code & 0x3F));
+		}
+	}
+
+	static bool FailJSON(_In_ std::string_view In_Source, _In_ const size_t& In_Pos, _In_ const std::string& In_Message)
+	{
+		const size_t pos = (std::min)(In_Pos, In_Source.size());
+		const size_t line = static_cast<size_t>(std::count(In_Source.begin(), In_Source.begin() + static_cast<std::ptrdiff_t>(pos), '\n')) + 1;
+		YAMLParser::Log(YAMLParser::LogLevel::Error, "JSON: " + In_Message + "(" + std::to_string(line) + "sڕt)");
+		return false;
+	}
+
+	static bool ReadFile(_In_ const std::string& In_FilePath, _Out_ std::string& Out_Source)
+	{
+		Out_Source.clear();
+		if (In_FilePath.empty()) return false;
+		std::ifstream ifs(In_FilePath, std::ios::binary);
+		if (!ifs)
+		{
+			YAMLParser::Log(YAMLParser::LogLevel::Error, "t@CJ܂: " + In_FilePath);
+			return false;
+		}
+		std::ostringstream buffer;
+		buffer << ifs.rdbuf();
+		Out_Source = buffer.str();
+		return true;
+	}
+
+	static bool CheckWritten(_Inout_ std::ofstream& In_Stream, _In_ const std::string& In_FilePath)
+	{
+		In_Stream.flush();
+		if (In_Stream) return true;
+		YAMLParser::Log(YAMLParser::LogLevel::Error, "t@C݃G[: " + In_FilePath);
+		return false;
+	}
+};
@@ -0,0 +1,455 @@
+#pragma once
+
+#include "YAMLParser.hpp"
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+
+/// <summary>
+/// C[̒lʂ̃C[̒lƂǂ̂悤ɍ邩\܂B
+/// </summary>
+enum class YAMLLayerMerge
+{
+	Deep,		// }bv̓L[ƂɍċAIɃ}[WAXJ[ƃV[PX͏ʂ̃C[̒lŒu
+	Shallow		// [g̃L[̒l}[WɊۂƒu
+};
+
+/// <summary>
+/// YAMLhLgC[ƂďdˁAォǉC[D悵ĒlhLgłB
+/// ǂݍݎɃ}[WRs[͍炸AQƂꂽpXƂɒl^郌C[𒲂ׂċL^܂B
+/// C[̒ǉEւE폜͐VC[\ƂăAg~bNɌJAL^ʂ͂̎_Ŕj܂B
+/// 擾n̊֐͕̃Xbh瓯ɌĂяo܂B
+/// </summary>
+class YAMLLayeredDocument
+{
+public:
+	using Layer = std::shared_ptr<const YAMLParser>;
+
+	YAMLLayeredDocument() : m_Stack(std::make_shared<const Stack>()) {}
+	YAMLLayeredDocument(const YAMLLayeredDocument&) = delete;
+	YAMLLayeredDocument& operator=(const YAMLLayeredDocument&) = delete;
+
+	/// <summary>
+	/// łDx̍C[ƂăhLgǉ܂B
+	/// </summary>
+	/// <param name="In_Name">C[̖OBւ폜Ɏg܂B</param>
+	/// <param name="In_Layer">ǉhLgBȍ~͕ύXȂłB</param>
+	/// <param name="In_Merge">ʂ̃C[Ƃ̍@B</param>
+	/// <returns>ǉꍇ trueAÕC[ꍇ false Ԃ܂B</returns>
+	bool PushLayer(_In_ const std::string& In_Name, _In_ Layer In_Layer, _In_ const YAMLLayerMerge& In_Merge = YAMLLayerMerge::Deep)
+	{
+		if (!In_Layer) return false;
+		std::lock_guard<std::mutex> lock(m_WriteMutex);
+		const auto current = std::atomic_load(&m_Stack);
+		if (FindLayer(*current, In_Name) != NotFound)
+		{
+			YAMLParser::Log(YAMLParser::LogLevel::Warning, "ÕC[ɂ܂: " + In_Name);
+			return false;
+		}
+		auto next = std::make_shared<Stack>();
+		next->layers = current->layers;
+		next->layers.push_back(LayerEntry{ In_Name, std::move(In_Layer), In_Merge });
+		Publish(std::move(next));
+		return true;
+	}
+
+	/// <summary>
+	/// ̃C[̃hLgւ܂BDxƍ@͕ς܂B
+	/// </summary>
+	/// <param name="In_Name">ւ郌C[̖OB</param>
+	/// <param name="In_Layer">VhLgBȍ~͕ύXȂłB</param>
+	/// <returns>ւꍇ trueAC[Ȃꍇ false Ԃ܂B</returns>
+	bool SetLayer(_In_ const std::string& In_Name, _In_ Layer In_Layer)
+	{
+		if (!In_Layer) return false;
+		std::lock_guard<std::mutex> lock(m_WriteMutex);
+		const auto current = std::atomic_load(&m_Stack);
+		const size_t index = FindLayer(*current, In_Name);
+		if (index == NotFound) return false;
+		auto next = std::make_shared<Stack>();
+		next->layers = current->layers;
+		next->layers[index].parser = std::move(In_Layer);
+		Publish(std::move(next));
+		return true;
+	}
+
+	/// <summary>
+	/// YAMLt@Cǂݍ݁AÕC[΍ւAȂ΍łDx̍C[ƂĒǉ܂B
+	/// ǂݍ݂Ɏsꍇ݂͌̃C[\ێ܂B
+	/// </summary>
+	/// <param name="In_Name">C[̖OB</param>
+	/// <param name="In_FilePath">ǂݍYAMLt@C̃pXB</param>
+	/// <param name="In_Merge">ǉꍇ̉ʂ̃C[Ƃ̍@B</param>
+	/// <returns>ǂݍ݂ɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	bool LoadLayer(_In_ const std::string& In_Name, _In_ const std::string& In_FilePath, _In_ const YAMLLayerMerge& In_Merge = YAMLLayerMerge::Deep)
+	{
+		auto parser = std::make_shared<YAMLParser>();
+		if (!parser->ParseYAML(In_FilePath)) return false;
+		return SetLayer(In_Name, parser) || PushLayer(In_Name, std::move(parser), In_Merge);
+	}
+
+	/// <summary>
+	/// C[폜܂B
+	/// </summary>
+	/// <param name="In_Name">폜郌C[̖OB</param>
+	/// <returns>폜ꍇ trueAC[Ȃꍇ false Ԃ܂B</returns>
+	bool RemoveLayer(_In_ const std::string& In_Name)
+	{
+		std::lock_guard<std::mutex> lock(m_WriteMutex);
+		const auto current = std::atomic_load(&m_Stack);
+		const size_t index = FindLayer(*current, In_Name);
+		if (index == NotFound) return false;
+		auto next = std::make_shared<Stack>();
+		next->layers = current->layers;
+		next->layers.erase(next->layers.begin() + static_cast<std::ptrdiff_t>(index));
+		Publish(std::move(next));
+		return true;
+	}
+
+	/// <summary>
+	/// OŃC[̃hLg擾܂BC[Ȃꍇ nullptr Ԃ܂B
+	/// </summary>
+	inline Layer GetLayer(_In_ const std::string& In_Name) const
+	{
+		const auto stack = std::atomic_load(&m_Stack);
+		const size_t index = FindLayer(*stack, In_Name);
+		return (index == NotFound) ? nullptr : stack->layers[index].parser;
+	}
+
+	/// <summary>
+	/// C[̖ODx̒ႢɎ擾܂B
+	/// </summary>
+	inline std::vector<std::string> GetLayerNames() const
+	{
+		const auto stack = std::atomic_load(&m_Stack);
+		std::vector<std::string> names;
+		names.reserve(stack->layers.size());
+		for (const auto& layer : stack->layers) names.push_back(layer.name);
+		return names;
+	}
+
+	inline size_t GetLayerCount() const { return std::atomic_load(&m_Stack)->layers.size(); }
+
+	/// <summary>
+	/// C[\̔ł̔ԍ擾܂BC[̒ǉEւE폜̂тɑ܂B
+	/// </summary>
+	inline uint64_t GetVersion() const noexcept { return m_Version.load(std::memory_order_acquire); }
+
+	inline std::string GetString(_In_ const std::string& In_keyPath, _In_ const bool& In_IncludeQuotes = false) const
+	{
+		const auto stack = std::atomic_load(&m_Stack);
+		const YAMLParser* layer = FindValueLayer(*stack, In_keyPath);
+		return layer ? layer->GetString(In_keyPath, In_IncludeQuotes) : std::string();
+	}
+
+	/// <summary>
+	/// L[pXŕl𕡐Ɏ擾܂BԂ͒l^C[̃hLg𒼐ڎQƂ邽߁A
+	/// ̃C[ւ܂͍폜́AGetLayer Ŏ擾hLgȂǂێĂȂ薳ɂȂ܂B
+	/// lz̗vf YAMLParser::GetStringView Ɠ̕Ԃ܂B
+	/// </summary>
+	inline std::string_view GetStringView(_In_ const std::string& In_keyPath, _In_ const bool& In_IncludeQuotes = false) const
+	{
+		const auto stack = std::atomic_load(&m_Stack);
+		const YAMLParser* layer = FindValueLayer(*stack, In_keyPath);
+		return layer ? layer->GetStringView(In_keyPath, In_IncludeQuotes) : std::string_view();
+	}
+
+	inline bool GetBool(_In_ const std::string& In_keyPath) const
+	{
+		const auto stack = std::atomic_load(&m_Stack);
+		const YAMLParser* layer = FindValueLayer(*stack, In_keyPath);
+		return layer ? layer->GetBool(In_keyPath) : false;
+	}
+	inline int GetInt(_In_ const std::string& In_keyPath) const
+	{
+		const auto stack = std::atomic_load(&m_Stack);
+		const YAMLParser* layer = FindValueLayer(*stack, In_keyPath);
+		return layer ? layer->GetInt(In_keyPath) : 0;
+	}
+	inline float GetFloat(_In_ const std::string& In_keyPath) const
+	{
+		const auto stack = std::atomic_load(&m_Stack);
+		const YAMLParser* layer = FindValueLayer(*stack, In_keyPath);
+		return layer ? layer->GetFloat(In_keyPath) : 0.0f;
+	}
+	inline double GetDouble(_In_ const std::string& In_keyPath) const
+	{
+		const auto stack = std::atomic_load(&m_Stack);
+		const YAMLParser* layer = FindValueLayer(*stack, In_keyPath);
+		return layer ? layer->GetDouble(In_keyPath) : 0.0;
+	}
+	inline bool HasKey(_In_ const std::string& In_keyPath) const
+	{
+		if (In_keyPath.empty()) return false;
+		const auto stack = std::atomic_load(&m_Stack);
+		return Resolve(*stack, In_keyPath) != nullptr;
+	}
+
+	/// <summary>
+	/// w肳ꂽpX̒l^Ă郌C[̖O擾܂B}bv̏ꍇ͍łDx̍C[Ԃ܂B
+	/// </summary>
+	/// <param name="In_keyPath">YAML̃L[̃pXihbg؂jB</param>
+	/// <returns>C[̖OBpX݂Ȃꍇ͋󕶎Ԃ܂B</returns>
+	inline std::string GetSourceLayer(_In_ const std::string& In_keyPath) const
+	{
+		const auto stack = std::atomic_load(&m_Stack);
+		const auto candidates = Resolve(*stack, In_keyPath);
+		return candidates ? stack->layers[candidates->front().layer].name : std::string();
+	}
+
+	/// <summary>
+	/// w肳ꂽpX̃}bv}[Wʂ̃L[擾܂B̃pX̓[g\܂B
+	/// </summary>
+	/// <param name="In_keyPath">YAML̃L[̃pXihbg؂jB</param>
+	/// <returns>L[̈ꗗ(͕s)BpX݂Ȃ}bvłȂꍇ͋̈ꗗԂ܂B</returns>
+	std::vector<std::string> GetKeys(_In_ const std::string& In_keyPath) const
+	{
+		const auto stack = std::atomic_load(&m_Stack);
+		const auto candidates = Resolve(*stack, In_keyPath);
+		std::vector<std::string> keys;
+		if (!candidates || candidates->front().node->type != YAMLParser::YAMLNode::Type::Map) return keys;
+
+		std::unordered_set<std::string_view> seen;
+		for (const auto& candidate : *candidates)
+		{
+			for (const auto& [key, child] : std::get<YAMLParser::YAMLMap>(candidate.node->value))
+			{
+				if (seen.insert(key).second) keys.emplace_back(key);
+			}
+		}
+		return keys;
+	}
+
+	/// <summary>
+	/// ׂẴC[}[W1̃hLg쐬܂B̃C[ɂ܂}bv In_Resource ɐV܂B
+	/// 1̃C[l^镔؂́ÃC[̃\[X(GetResource) In_Resource ƓłΕɋLA
+	/// قȂꍇ In_Resource ɕ܂B̂ߌʂmۂˑ̂ In_Resource ŁA
+	/// C[̃hLg₻̃\[Xjg܂B
+	/// </summary>
+	/// <param name="In_Resource">}[WhLg̃m[h̊mۂɎg\[XB</param>
+	/// <returns>}[WhLgԂ܂B</returns>
+	YAMLParser Flatten(_In_ std::pmr::memory_resource* In_Resource = std::pmr::get_default_resource()) const
+	{
+		const auto stack = std::atomic_load(&m_Stack);
+		YAMLParser flattened(In_Resource);
+		std::vector<Candidate> roots;
+		for (size_t i = stack->layers.size(); i-- > 0;)
+			roots.push_back(Candidate{ static_cast<uint32_t>(i), &stack->layers[i].parser->GetRootNode() });
+		CopiedNodes copied;
+		flattened.SetRootNode(MergeMaps(*stack, roots, In_Resource, copied));
+		return flattened;
+	}
+
+private:
+	using YAMLNode = YAMLParser::YAMLNode;
+
+	static constexpr size_t NotFound = static_cast<size_t>(-1);
+
+	struct LayerEntry
+	{
+		std::string name;
+		Layer parser;
+		YAMLLayerMerge merge;
+	};
+
+	// pXɒl^郌C[Ƃ̃m[hBlz̗vf̏ꍇ͐lz̃m[h
+	struct Candidate
+	{
+		uint32_t layer;
+		const YAMLNode* node;
+	};
+	using Resolution = std::vector<Candidate>;	// Dx̍B擪ȊOׂ͂ă}bv
+	using ResolutionPtr = std::shared_ptr<const Resolution>;
+
+	// ʂL^pX̐̏Bꍇ͋L^ׂĔjċL^
+	static constexpr size_t MaxCachedPaths = 4096;
+
+	// J layers ύXȂBcache ͒l̂pX̉ʂL^(݂ȂpX̖₢킹őȂ悤)
+	struct Stack
+	{
+		std::vector<LayerEntry> layers;		// Dx̒Ⴂ
+		mutable std::shared_mutex cacheMutex;
+		mutable std::unordered_map<std::string, ResolutionPtr> cache;
+	};
+
+	static size_t FindLayer(_In_ const Stack& In_Stack, _In_ const std::string& In_Name) noexcept
+	{
+		for (size_t i = 0; i < In_Stack.layers.size(); ++i)
+		{
+			if (In_Stack.layers[i].name == In_Name) return i;
+		}
+		return NotFound;
+	}
+
+	/// <summary>
+	/// ʂ̃m[h̉ɉʂ̃m[hd˂邩𔻒肵ȂAl^m[h̗ɒǉ܂B
+	/// }bv͂艺ʂ̃}bvƃ}[WA}bvȊO̒l͂艺ʂ̒lB܂B}bv̉̃}bvȊO̒l͖܂B
+	/// </summary>
+	/// <returns>ɉʂ̃C[𒲂ׂKvꍇ true Ԃ܂B</returns>
+	static bool Chain(_In_ const Stack& In_Stack, _In_ const Candidate& In_Candidate, _Inout_ std::vector<Candidate>& Out_Chain)
+	{
+		if (In_Candidate.node->type != YAMLNode::Type::Map)
+		{
+			if (Out_Chain.empty()) Out_Chain.push_back(In_Candidate);
+			return false;
+		}
+		Out_Chain.push_back(In_Candidate);
+		return In_Stack.layers[In_Candidate.layer].merge == YAMLLayerMerge::Deep;
+	}
+
+	static const YAMLNode* FindChild(_In_ const YAMLNode& In_Node, _In_ std::string_view In_Token, _In_ const bool& In_IsLast)
+	{
+		size_t idx = 0;
+		const auto toIndex = [&]()
+		{
+			const auto [ptr, ec] = std::from_chars(In_Token.data(), In_Token.data() + In_Token.size(), idx, 10);
+			return !In_Token.empty() && ec == std::errc() && ptr == In_Token.data() + In_Token.size();
+		};
+		switch (In_Node.type)
+		{
+		case YAMLNode::Type::Map:
+		{
+			const auto& map = std::get<YAMLParser::YAMLMap>(In_Node.value);
+			const auto itr = map.find(YAMLParser::YAMLString(In_Token));
+			return (itr == map.end()) ? nullptr : itr->second.get();
+		}
+		case YAMLNode::Type::Sequence:
+		{
+			if (!toIndex()) return nullptr;
+			const auto& seq = std::get<YAMLParser::YAMLSeq>(In_Node.value);
+			return (idx < seq.size()) ? seq[idx].get() : nullptr;
+		}
+		case YAMLNode::Type::NumericArray:
+		{
+			// lz̗vf̓m[hȂ߁Alz̃m[hlƂĈ
+			if (!In_IsLast || !toIndex()) return nullptr;
+			return (idx < std::get<YAMLParser::YAMLNumericArray>(In_Node.value).size()) ? &In_Node : nullptr;
+		}
+		default:
+			return nullptr;
+		}
+	}
+
+	/// <summary>
+	/// pXɒl^m[hDx̍Ɏ擾܂B̓C[HĉAʂC[\ɋL^܂B
+	/// L^͔j邱Ƃ邽߁Aʂ͋L|C^ŕԂ܂BpX݂Ȃꍇ nullptr Ԃ܂B
+	/// </summary>
+	static ResolutionPtr Resolve(_In_ const Stack& In_Stack, _In_ const std::string& In_keyPath)
+	{
+		{
+			std::shared_lock<std::shared_mutex> lock(In_Stack.cacheMutex);
+			const auto itr = In_Stack.cache.find(In_keyPath);
+			if (itr != In_Stack.cache.end()) return itr->second;
+		}
+
+		Resolution current, next;
+		for (size_t i = In_Stack.layers.size(); i-- > 0;)
+			current.push_back(Candidate{ static_cast<uint32_t>(i), &In_Stack.layers[i].parser->GetRootNode() });
+
+		size_t pos = 0;
+		while (pos < In_keyPath.size() && !current.empty())
+		{
+			const size_t end = (std::min)(In_keyPath.find('.', pos), In_keyPath.size());
+			const std::string_view token = std::string_view(In_keyPath).substr(pos, end - pos);
+			next.clear();
+			for (const auto& candidate : current)
+			{
+				const YAMLNode* child = FindChild(*candidate.node, token, end == In_keyPath.size());
+				if (child && !Chain(In_Stack, Candidate{ candidate.layer, child }, next)) break;
+			}
+			current.swap(next);
+			pos = end + 1;
+		}
+
+		if (current.empty()) return nullptr;
+		auto resolved = std::make_shared<const Resolution>(std::move(current));
+		std::unique_lock<std::shared_mutex> lock(In_Stack.cacheMutex);
+		if (In_Stack.cache.size() >= MaxCachedPaths) In_Stack.cache.clear();
+		return In_Stack.cache.try_emplace(In_keyPath, std::move(resolved)).first->second;
+	}
+
+	// l}bvłȂꍇ́Al^郌C[̃p[T[Ō^ϊ邽߂ɂ̃C[Ԃ
+	static const YAMLParser* FindValueLayer(_In_ const Stack& In_Stack, _In_ const std::string& In_keyPath)
+	{
+		const auto candidates = Resolve(In_Stack, In_keyPath);
+		return candidates ? In_Stack.layers[candidates->front().layer].parser.get() : nullptr;
+	}
+
+	// ʂ̃\[X畡m[h(GCAXŋLĂm[h1x邽)
+	using CopiedNodes = std::unordered_map<const YAMLNode*, std::shared_ptr<YAMLNode>>;
+
+	static std::shared_ptr<YAMLNode> AllocateNode(_In_ std::pmr::memory_resource* In_Resource, _In_ YAMLNode&& In_Node)
+	{
+		return std::allocate_shared<YAMLNode>(std::pmr::polymorphic_allocator<YAMLNode>(In_Resource), std::move(In_Node));
+	}
+
+	// m[hƂ̎q In_Resource ɕ܂B̐e狤LĂm[h͕L܂B
+	static std::shared_ptr<YAMLNode> CopyTree(_In_ const std::shared_ptr<YAMLNode>& In_Node, _In_ std::pmr::memory_resource* In_Resource, _Inout_ CopiedNodes& Out_Copied)
+	{
+		const auto found = Out_Copied.find(In_Node.get());
+		if (found != Out_Copied.end()) return found->second;
+		auto copy = AllocateNode(In_Resource, YAMLNode(*In_Node, In_Resource));
+		if (copy->type == YAMLNode::Type::Map)
+		{
+			for (auto& keyValue : std::get<YAMLParser::YAMLMap>(copy->value))
+				keyValue.second = CopyTree(keyValue.second, In_Resource, Out_Copied);
+		}
+		else if (copy->type == YAMLNode::Type::Sequence)
+		{
+			for (auto& child : std::get<YAMLParser::YAMLSeq>(copy->value))
+				child = CopyTree(child, In_Resource, Out_Copied);
+		}
+		Out_Copied.emplace(In_Node.get(), copy);
+		return copy;
+	}
+
+	/// <summary>
+	/// Dx̍ɕ񂾃}bv}[W܂Bl^m[h1̃L[́A
+	/// ̃C[̃\[X In_Resource ł΃m[hLAłȂ In_Resource ɕ܂B
+	/// </summary>
+	static YAMLNode MergeMaps(_In_ const Stack& In_Stack, _In_ const std::vector<Candidate>& In_Maps, _In_ std::pmr::memory_resource* In_Resource,
+		_Inout_ CopiedNodes& Out_Copied)
+	{
+		YAMLParser::YAMLMap merged(In_Resource);
+		std::vector<Candidate> chain;
+		for (const auto& source : In_Maps)
+		{
+			for (const auto& [key, child] : std::get<YAMLParser::YAMLMap>(source.node->value))
+			{
+				if (merged.find(key) != merged.end()) continue;
+
+				chain.clear();
+				const std::shared_ptr<YAMLNode>* shared = nullptr;
+				for (const auto& candidate : In_Maps)
+				{
+					const auto& map = std::get<YAMLParser::YAMLMap>(candidate.node->value);
+					const auto itr = map.find(key);
+					if (itr == map.end()) continue;
+					if (chain.empty()) shared = &itr->second;
+					if (!Chain(In_Stack, Candidate{ candidate.layer, itr->second.get() }, chain)) break;
+				}
+				std::shared_ptr<YAMLNode> value;
+				if (chain.size() > 1)
+					value = AllocateNode(In_Resource, MergeMaps(In_Stack, chain, In_Resource, Out_Copied));
+				else if (In_Stack.layers[chain.front().layer].parser->GetResource() == In_Resource)
+					value = *shared;
+				else
+					value = CopyTree(*shared, In_Resource, Out_Copied);
+				merged.emplace(YAMLParser::YAMLString(key, In_Resource), std::move(value));
+			}
+		}
+		return YAMLNode(std::move(merged));
+	}
+
+	// ݃bNێԂŌĂяo
+	void Publish(_In_ std::shared_ptr<Stack> In_Next)
+	{
+		std::atomic_store(&m_Stack, std::shared_ptr<const Stack>(std::move(In_Next)));
+		m_Version.fetch_add(1, std::memory_order_release);
+	}
+
+	std::shared_ptr<const Stack> m_Stack;	// std::atomic_load / std::atomic_store ł̂݃ANZX
+	std::atomic<uint64_t> m_Version{ 1 };
+	std::mutex m_WriteMutex;
+};
@@ -2,25 +2,184 @@
 
 #include <Windows.h>
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <memory>
+#include <memory_resource>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <variant>
 #include <vector>
 
+// YAMLPARSER_ENABLE_STATS `ĂCN[hƁAp[X(GetStats)ƕۑ(SaveYAML  Out_Stats)̓vW܂B
+// `̏ꍇAvׂ͂ăRpCɎ菜܂B
+#if defined(YAMLPARSER_ENABLE_STATS)
+#include <chrono>
+#define YAMLPARSER_STATS(...) __VA_ARGS__
+#else
+#define YAMLPARSER_STATS(...)
+#endif
+
 class YAMLParser
 {
 public:
 	class YAMLNode;
-	using YAMLMap = std::unordered_map<std::string, std::shared_ptr<YAMLNode>>;
-	using YAMLSeq = std::vector<std::shared_ptr<YAMLNode>>;
-	using YAMLScalar = std::string;
+	// m[hێ镶ƃReíAp[T[̃\[Xmۂ܂B
+	using YAMLString = std::pmr::string;
+	using YAMLMap = std::pmr::unordered_map<YAMLString, std::shared_ptr<YAMLNode>>;
+	using YAMLSeq = std::pmr::vector<std::shared_ptr<YAMLNode>>;
+	using YAMLScalar = YAMLString;
+
+	/// <summary>
+	/// l̃V[PXAvfƂ̃m[h炸ɘA֕ێzłB
+	/// vf͌̕\L̂܂܍Čłꍇɂ̂݊i[邽߁AoƓǂݍ񂾂ƂƓɂȂ܂B
+	/// </summary>
+	struct YAMLNumericArray
+	{
+		using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+		// vf̌^`܂B
+		enum class ElementType : uint8_t
+		{
+			Int64,
+			Double
+		};
+
+		// 1vf̕\Lôɏ\ȃobt@̑傫
+		static constexpr size_t FormatBufferSize = 64;
+
+		explicit YAMLNumericArray(allocator_type In_Allocator = {}) : ints(In_Allocator), doubles(In_Allocator) {}
+		YAMLNumericArray(const YAMLNumericArray& In_Other, allocator_type In_Allocator)
+			: elementType(In_Other.elementType), precision(In_Other.precision),
+			ints(In_Other.ints, In_Allocator), doubles(In_Other.doubles, In_Allocator) {}
+		YAMLNumericArray(const YAMLNumericArray&) = default;
+		YAMLNumericArray(YAMLNumericArray&&) = default;
+		YAMLNumericArray& operator=(const YAMLNumericArray&) = default;
+		YAMLNumericArray& operator=(YAMLNumericArray&&) = default;
+
+		inline size_t size() const noexcept { return (elementType == ElementType::Int64) ? ints.size() : doubles.size(); }
+
+		/// <summary>
+		/// w肳ꂽvfAǂݍ񂾂ƂƓ\Lŏo܂B
+		/// </summary>
+		/// <returns>Out_Buffer QƂ镶B</returns>
+		std::string_view Format(_In_ const size_t& In_Index, _Out_ char (&Out_Buffer)[FormatBufferSize]) const noexcept
+		{
+			char* const last = Out_Buffer + FormatBufferSize;
+			std::to_chars_result result;
+			if (elementType == ElementType::Int64)
+				result = std::to_chars(Out_Buffer, last, ints[In_Index]);
+			else if (precision < 0)
+				result = std::to_chars(Out_Buffer, last, doubles[In_Index]);
+			else
+				result = std::to_chars(Out_Buffer, last, doubles[In_Index], std::chars_format::fixed, precision);
+			if (result.ec != std::errc()) return std::string_view();
+			return std::string_view(Out_Buffer, static_cast<size_t>(result.ptr - Out_Buffer));
+		}
+
+		/// <summary>
+		/// l̕\LvfƂĒǉ܂Bŏ̗vfŐ(̏ꍇ͏_ȉ̌)܂A
+		/// ƈقȂ\LAFormat œČłȂ\L̏ꍇ͒ǉ܂B
+		/// </summary>
+		/// <returns>ǉꍇ trueAǉȂꍇ false Ԃ܂B</returns>
+		bool Append(_In_ std::string_view In_Text)
+		{
+			if (In_Text.empty()) return false;
+			if (size() == 0)
+			{
+				const size_t exponent = In_Text.find_first_of("eE");
+				const size_t point = In_Text.find('.');
+				const bool isInteger = exponent == std::string_view::npos && point == std::string_view::npos;
+				elementType = isInteger ? ElementType::Int64 : ElementType::Double;
+				precision = (isInteger || exponent != std::string_view::npos) ? -1 : static_cast<int>(In_Text.size() - point - 1);
+			}
+
+			const char* const first = In_Text.data();
+			const char* const last = first + In_Text.size();
+			if (elementType == ElementType::Int64)
+			{
+				int64_t value = 0;
+				const auto [ptr, ec] = std::from_chars(first, last, value);
+				if (ec != std::errc() || ptr != last) return false;
+				ints.push_back(value);
+			}
+			else
+			{
+				double value = 0.0;
+				const auto [ptr, ec] = std::from_chars(first, last, value);
+				if (ec != std::errc() || ptr != last || !std::isfinite(value)) return false;
+				doubles.push_back(value);
+			}
+
+			// "+1"  "1.50"  "1.5" ݂̍ȂǁA\LςĂ܂l͎󂯕tȂ
+			// ̏Ȃf10i\L͕Kɖ߂邽߁AoĔׂ̂Ȃ
+			if (elementType == ElementType::Int64 ? IsPlainDecimal(In_Text, 0, 18) && In_Text != "-0"
+				: precision >= 0 && IsPlainDecimal(In_Text, static_cast<size_t>(precision), 15))
+				return true;
+			char buffer[FormatBufferSize];
+			if (Format(size() - 1, buffer) == In_Text) return true;
+			if (elementType == ElementType::Int64) ints.pop_back();
+			else doubles.pop_back();
+			return false;
+		}
+
+		// Ɨ] 0 ̂Ȃ10i\LŁA_ȉ In_Fraction AŜ In_MaxDigits ȓǂ
+		static bool IsPlainDecimal(_In_ std::string_view In_Text, _In_ const size_t& In_Fraction, _In_ const size_t& In_MaxDigits) noexcept
+		{
+			size_t i = (!In_Text.empty() && In_Text[0] == '-') ? 1 : 0;
+			const size_t integerBegin = i;
+			while (i < In_Text.size() && In_Text[i] >= '0' && In_Text[i] <= '9') ++i;
+			const size_t integerDigits = i - integerBegin;
+			if (integerDigits == 0 || (integerDigits > 1 && In_Text[integerBegin] == '0')) return false;
+			if (In_Fraction > 0)
+			{
+				if (i >= In_Text.size() || In_Text[i] != '.') return false;
+				const size_t fractionBegin = ++i;
+				while (i < In_Text.size() && In_Text[i] >= '0' && In_Text[i] <= '9') ++i;
+				if (i - fractionBegin != In_Fraction) return false;
+			}
+			return i == In_Text.size() && integerDigits + In_Fraction <= In_MaxDigits;
+		}
+
+		ElementType elementType = ElementType::Int64;	// vf̌^
+		int precision = -1;								// Double ̏_ȉ̌B-1 ͉\ȍŒZ̕\L
+		std::pmr::vector<int64_t> ints;					// Int64 ̗vf
+		std::pmr::vector<double> doubles;				// Double ̗vf
+	};
+
+	/// <summary>
+	/// A̗vfQƂǂݎp̃r[ł(C++17  std::span ̑Ɏg܂)B
+	/// QƐ悪ύX܂͔j܂ŗLłB
+	/// </summary>
+	template <class T>
+	class YAMLArrayView
+	{
+	public:
+		YAMLArrayView() noexcept = default;
+		YAMLArrayView(_In_ const T* In_Data, _In_ const size_t& In_Size) noexcept : m_Data(In_Data), m_Size(In_Size) {}
+
+		inline const T* data() const noexcept { return m_Data; }
+		inline size_t size() const noexcept { return m_Size; }
+		inline bool empty() const noexcept { return m_Size == 0; }
+		inline const T* begin() const noexcept { return m_Data; }
+		inline const T* end() const noexcept { return m_Data + m_Size; }
+		inline const T& operator[](_In_ const size_t& In_Index) const noexcept { return m_Data[In_Index]; }
+
+	private:
+		const T* m_Data = nullptr;
+		size_t m_Size = 0;
+	};
 
 	// YAML hLg̃m[h(XJ[lAV[PXA}bv)\܂B
 	class YAMLNode
@@ -31,7 +190,8 @@ public:
 		{
 			Scalar,
 			Sequence,
-			Map
+			Map,
+			NumericArray	// l̃V[PX(YAMLNumericArray)BpXCxgł̓V[PXƂĈ
 		};
 
 		// }`CXJ[̃^Cv`܂B
@@ -43,1123 +203,4577 @@ public:
 		};
 
 		YAMLNode(YAMLScalar val, MultilineType mtype = MultilineType::None)
-			: type(Type::Scalar), value(val), multilineType(mtype) {}
-		YAMLNode(YAMLSeq val) : type(Type::Sequence), value(val), multilineType(MultilineType::None) {}
-		YAMLNode(YAMLMap val) : type(Type::Map), value(val), multilineType(MultilineType::None) {}
+			: type(Type::Scalar), value(std::move(val)), multilineType(mtype) {}
+		YAMLNode(const std::string& val, MultilineType mtype = MultilineType::None)
+			: YAMLNode(YAMLScalar(val.data(), val.size()), mtype) {}
+		YAMLNode(const char* val, MultilineType mtype = MultilineType::None)
+			: YAMLNode(YAMLScalar(val), mtype) {}
+		YAMLNode(YAMLSeq val) : type(Type::Sequence), value(std::move(val)), multilineType(MultilineType::None) {}
+		YAMLNode(YAMLMap val) : type(Type::Map), value(std::move(val)), multilineType(MultilineType::None) {}
+		YAMLNode(YAMLNumericArray val) : type(Type::NumericArray), value(std::move(val)), multilineType(MultilineType::None) {}
+		// lw肳ꂽ\[Xɕ܂Bqm[h͕ɋL܂B
+		YAMLNode(const YAMLNode& In_Other, std::pmr::memory_resource* In_Resource)
+			: type(In_Other.type), value(CopyValue(In_Other.value, In_Resource)), multilineType(In_Other.multilineType) {}
+		YAMLNode(const YAMLNode&) = default;
+		YAMLNode(YAMLNode&&) = default;
+		YAMLNode& operator=(const YAMLNode&) = default;
+		YAMLNode& operator=(YAMLNode&&) = default;
 
 		Type type;	// m[h̃^Cv
-		std::variant<YAMLScalar, YAMLSeq, YAMLMap> value;	// m[h̒l
+		std::variant<YAMLScalar, YAMLSeq, YAMLMap, YAMLNumericArray> value;	// m[h̒l
 		MultilineType multilineType = MultilineType::None;	// }`CXJ[̃^Cv
-	};
-
-	/// <summary>
-	/// w肳ꂽt@CpXYAMLt@Cǂݍ݁Ap[X܂B
-	/// </summary>
-	/// <param name="In_FilePath">ǂݍYAMLt@C̃pXB</param>
-	/// <returns>p[Xɐꍇ trueAsꍇ false Ԃ܂B</returns>
-	bool ParseYAML(_In_ const std::string& In_FilePath)
-	{
-		if (In_FilePath.empty()) return false;
 
-		std::ifstream ifs(In_FilePath, std::ios::binary);
-		if (!ifs)
+		/// <summary>
+		/// ẽnbVl擾܂BɎq̃nbVlvZăm[hɋL^Aȍ~͋L^lԂ܂B
+		/// }bv̗vf̏ɂ͈ˑAlz͓\L̗vfV[PXƓlɂȂ܂B
+		/// YAMLParser  Set n֐ GenerateNode ɂύXł́AύXpX̃m[h̋L^j܂B
+		/// m[h𒼐ڏꍇ́Ãm[hƑĉׂĂ InvalidateHash ĂłB
+		/// </summary>
+		uint64_t GetHash() const
 		{
-			std::cerr << "t@CJ܂: " << In_FilePath << std::endl;
-			return false;
-		}
-
-		// f[^̓ǂݍ
-		std::ostringstream buffer;
-		buffer << ifs.rdbuf();
+			uint64_t hash = m_Hash.value.load(std::memory_order_relaxed);
+			if (hash != 0) return hash;
 
-		// Shift_JISUTF-8ւ̕ϊ
-		std::istringstream iss(Convert_UTF8_To_ShiftJIS(buffer.str()));
+			switch (type)
+			{
+			case Type::Scalar:
+				hash = HashScalar(std::get<YAMLScalar>(value), multilineType);
+				break;
+			case Type::Sequence:
+			{
+				const auto& seq = std::get<YAMLSeq>(value);
+				hash = SequenceSeed;
+				for (const auto& child : seq) hash = HashMix(hash + child->GetHash());
+				hash = HashMix(hash ^ seq.size());
+				break;
+			}
+			case Type::NumericArray:
+			{
+				const auto& array = std::get<YAMLNumericArray>(value);
+				char buffer[YAMLNumericArray::FormatBufferSize];
+				hash = SequenceSeed;
+				for (size_t i = 0; i < array.size(); ++i) hash = HashMix(hash + HashScalar(array.Format(i, buffer), MultilineType::None));
+				hash = HashMix(hash ^ array.size());
+				break;
+			}
+			case Type::Map:
+			{
+				// vfƂ̃nbVl̘a͏ɈˑȂ
+				const auto& map = std::get<YAMLMap>(value);
+				uint64_t sum = 0;
+				for (const auto& keyValue : map) sum += HashMix(HashBytes(keyValue.first, MapKeySeed) ^ keyValue.second->GetHash());
+				hash = HashMix(MapSeed ^ HashMix(sum + map.size()));
+				break;
+			}
+			}
+			if (hash == 0) hash = 1;	// 0 ͖vZ\
+			m_Hash.value.store(hash, std::memory_order_relaxed);
+			return hash;
+		}
 
-		// sƂɕ
-		std::string currentLine;
-		YAMLLines yamlLines;
-		while (std::getline(iss, currentLine))
-			yamlLines.lines.push_back(currentLine);
+		// L^nbVlj܂Bc̋L^͔j܂B
+		inline void InvalidateHash() const noexcept { m_Hash.value.store(0, std::memory_order_relaxed); }
 
-		YAMLMap topMap;
+	private:
+		static constexpr uint64_t SequenceSeed = 0x5eb1f3a2c4d67e09ULL;
+		static constexpr uint64_t MapSeed = 0x3c6ef372fe94f82bULL;
+		static constexpr uint64_t MapKeySeed = 0xa54ff53a5f1d36f1ULL;
 
-		while (!yamlLines.eof())
+		static constexpr uint64_t HashMix(uint64_t In_Value) noexcept
 		{
-			const std::string& line = yamlLines.peek();
-			const std::string trimmed = TrimLeftWhitespace(line);
+			In_Value ^= In_Value >> 33;
+			In_Value *= 0xff51afd7ed558ccdULL;
+			In_Value ^= In_Value >> 33;
+			In_Value *= 0xc4ceb9fe1a85ec53ULL;
+			In_Value ^= In_Value >> 33;
+			return In_Value;
+		}
 
-			if (trimmed.empty() || trimmed[0] == '#')
+		static uint64_t HashBytes(_In_ std::string_view In_Bytes, _In_ const uint64_t& In_Seed) noexcept
+		{
+			uint64_t hash = In_Seed ^ (In_Bytes.size() * 0x9e3779b97f4a7c15ULL);
+			size_t i = 0;
+			for (; i + sizeof(uint64_t) <= In_Bytes.size(); i += sizeof(uint64_t))
 			{
-				yamlLines.next();
-				continue;
+				uint64_t word;
+				std::memcpy(&word, In_Bytes.data() + i, sizeof(word));
+				hash = HashMix(hash ^ word) + 0x9e3779b97f4a7c15ULL;
 			}
-			const size_t indent = IndentCounter(line);
-
-			if (indent != 0) break;
+			if (i < In_Bytes.size())
+			{
+				uint64_t word = 0;
+				std::memcpy(&word, In_Bytes.data() + i, In_Bytes.size() - i);
+				hash = HashMix(hash ^ word);
+			}
+			return HashMix(hash);
+		}
 
-			const size_t colon_pos = trimmed.find(':');
-			if (colon_pos == std::string::npos) break;
-			const std::string key = trimmed.substr(0, colon_pos);
-			yamlLines.next();
+		static inline uint64_t HashScalar(_In_ std::string_view In_Value, _In_ const MultilineType& In_MultilineType) noexcept
+		{
+			return HashBytes(In_Value, static_cast<uint64_t>(In_MultilineType) + 1);
+		}
 
-			if (!yamlLines.eof())
+		// m[h𕡐܂͑Ƃ͌vZ(m[h͕ύX邱Ƃ)
+		struct HashCache
+		{
+			HashCache() = default;
+			HashCache(const HashCache&) noexcept {}
+			HashCache& operator=(const HashCache&) noexcept
 			{
-				const std::string& next_line = yamlLines.peek();
-				const size_t next_indent = IndentCounter(next_line);
+				value.store(0, std::memory_order_relaxed);
+				return *this;
+			}
+			std::atomic<uint64_t> value{ 0 };
+		};
+		mutable HashCache m_Hash;	// ẽnbVl(0 ͖vZ)BǂݎpŋLc[vZ邽߃Ag~bN
 
-				if (next_indent > indent)
+		static std::variant<YAMLScalar, YAMLSeq, YAMLMap, YAMLNumericArray> CopyValue(const std::variant<YAMLScalar, YAMLSeq, YAMLMap, YAMLNumericArray>& In_Value,
+			std::pmr::memory_resource* In_Resource)
+		{
+			return std::visit([In_Resource](const auto& In_Container) -> std::variant<YAMLScalar, YAMLSeq, YAMLMap, YAMLNumericArray>
 				{
-					topMap[key] = ParseNode(yamlLines, next_indent);
-					continue;
-				}
-			}
-			topMap[key] = std::make_shared<YAMLNode>(TrimLeftWhitespace(trimmed.substr(colon_pos + 1)));
+					using Container = std::decay_t<decltype(In_Container)>;
+					return std::variant<YAMLScalar, YAMLSeq, YAMLMap, YAMLNumericArray>(std::in_place_type<Container>,
+						In_Container, typename Container::allocator_type(In_Resource));
+				}, In_Value);
 		}
-		m_YAMLData = YAMLNode(topMap);
-		return true;
-	}
+	};
+
+	// Ȍdvx`܂B
+	enum class LogLevel
+	{
+		Info,
+		Warning,
+		Error
+	};
+
+	// Ȍo͐BdvxƃbZ[W󂯎܂B
+	using LogSink = std::function<void(LogLevel, const std::string&)>;
+
+#if defined(YAMLPARSER_ENABLE_STATS)
+	// p[Xƕۑ̓v\܂B
+	struct YAMLStats
+	{
+		uint64_t bytesRead = 0;			// ǂݍ񂾃t@C̃oCg
+		uint64_t bytesWritten = 0;		// ۑt@C̃oCg(SaveYAML  Out_Stats ̂)
+		uint64_t lines = 0;				// s
+		uint64_t scalarNodes = 0;		// XJ[m[h
+		uint64_t sequenceNodes = 0;		// V[PXm[h
+		uint64_t mapNodes = 0;			// }bvm[h
+		uint64_t allocations = 0;		// m[h\zɔq[vmۉ(ŏIIȃCAEg̊TZ)
+		uint64_t allocatedBytes = 0;	// m[h\zɔq[vmۗ(ŏIIȃCAEg̊TZ)
+		size_t maxDepth = 0;			// Rei̍őlXg[([g1)
+		std::chrono::nanoseconds readTime{};		// t@Cǂݍ
+		std::chrono::nanoseconds transcodeTime{};	// R[hϊ
+		std::chrono::nanoseconds lineSplitTime{};	// s
+		std::chrono::nanoseconds treeBuildTime{};	// m[hc[\z
+		std::chrono::nanoseconds serializeTime{};	// ۑ̏o(SaveYAML  Out_Stats ̂)
+	};
+#endif
+
+	// p[X̎̏\܂B0 ͖łB𒴂͂͂̎_Ńp[Xł؂AG[ƂăOɏo͂܂B
+	struct YAMLParseLimits
+	{
+		size_t maxDepth = 1024;			// ReĩlXg̐[([g1)B\zm[h̔jۑ͍ċAŒH邽߁Am[hc[ꍇ͖ɂȂ
+		size_t maxNodes = 0;			// m[h̐(XJ[AReiAGCAX)
+		size_t maxScalarLength = 0;		// 1̃XJ[܂̓L[̃oCg
+		uint64_t maxTotalBytes = 0;		// ͑Ŝ̃oCg
+	};
+
+	// ǂݍ݂܂͕ۑ̐iłB
+	struct YAMLProgress
+	{
+		enum class Stage
+		{
+			Read,	// t@C̓ǂݍ݂ƕR[hϊ
+			Parse,	// m[hc[̍\z(done  total ͕ϊ̃eLXg̃oCg)
+			Write	// o
+		};
+
+		Stage stage;
+		uint64_t done = 0;		// ς݂̗
+		uint64_t total = 0;		// Ŝ̗(sȏꍇ 0)
+	};
+
+	// Ԃ̂p[X𒆎~Ai󂯎肷邽߂̐ݒł(SetParseControl Q)B
+	struct YAMLParseControl
+	{
+		const std::atomic<bool>* cancel = nullptr;				// true ɂȂp[X𒆎~
+		std::function<void(const YAMLProgress&)> onProgress;	// p[XĂXbhĂ΂
+	};
+
+	// 2YAMLf[^Ԃ̍\Iȍ1\܂B
+	struct YAMLChange
+	{
+		enum class Kind
+		{
+			Added,		// Vɂ̂ݑ݂
+			Removed,	// Âɂ̂ݑ݂
+			Changed		// ɑ݂邪l܂͌^قȂ
+		};
+
+		Kind kind;
+		std::string path;	// ̂m[h̃hbg؂pX
+	};
+
+	// p[XɌ1\܂Bʒu͓ǂݍ񂾃t@C(UTF-8)̃oCgPʂłB
+	struct YAMLDiagnostic
+	{
+		LogLevel level;			// Error ̓p[Xł؂AWarning ͓ǂݔ΂ӏ
+		size_t line;			// sԍ(1)
+		size_t column;			// s̃oCgʒu(1)
+		size_t offset;			// ͂̐擪̃oCgʒu(0)
+		std::string message;
+	};
 
 	/// <summary>
-	/// w肳ꂽt@CpXYAMLf[^ۑ܂B
+	/// ParseEvents  EmitEvents ʒmCxg󂯎nh[̊łB
+	/// Ăяo̓ev[gŐÓIɉ邽߁AhNXł͕KvȃCxg𓯖Œ`ĂB
+	/// n镶̓R[obN̊Ԃ̂ݗLłB
 	/// </summary>
-	/// <param name="In_FilePath">ۑ̃t@CpXw肵܂B</param>
-	/// <returns>ۑɐꍇ trueAsꍇ false Ԃ܂B</returns>
-	inline bool SaveYAML(_In_ const std::string& In_FilePath) const
+	struct YAMLEventHandler
 	{
-		if (In_FilePath.empty()) return false;
+		void OnMapStart() {}
+		void OnMapEnd() {}
+		void OnSeqStart() {}
+		void OnSeqEnd() {}
+		// }bv̎̒l̃L[
+		void OnKey(std::string_view) {}
+		void OnScalar(std::string_view, YAMLNode::MultilineType) {}
+		// ̒lɕtꂽAJ[(&name)
+		void OnAnchor(std::string_view) {}
+		// l̑ɒuꂽGCAX(*name)BParseEvents ͎QƐ̃CxgĐ܂
+		void OnAlias(std::string_view) {}
+	};
 
-		try
+	// SaveYAML ̏IvVłBlłׂ͂ẴRNVubN`ŏo܂B
+	struct YAMLSaveOptions
+	{
+		size_t flowSequenceMaxItems = 0;	// vfׂ1s̃XJ[ŁA̐ȉ̃V[PXt[`([a, b])ŏo(0 ͖)
+		size_t flowSequenceMaxWidth = 80;	// t[`ŏoV[PX̍ő啶(ʂƋ؂܂)
+	};
+
+	/// <summary>
+	/// Cxg SaveYAML ƓŃXg[֏onh[łBm[hc[oRYAMLo͂ł܂B
+	/// ParseYAML œǂݍ߂hLgɂɂ́Aŏʂ}bvɂĂB
+	/// vf̂ȂRei {} ܂ [] Ƃďo܂BAJ[ƃGCAX͒l̑O &amp;nameAl̑ *name Ƃďo܂B
+	/// </summary>
+	class YAMLEmitter
+	{
+	public:
+		/// <param name="Out_OStream">õXg[B</param>
+		/// <param name="In_IndentDepth">ŏʂ̃Rei̗vfoCfgB</param>
+		explicit YAMLEmitter(_Inout_ std::ostream& Out_OStream, _In_ const int& In_IndentDepth = 0)
+			: YAMLEmitter(Out_OStream, YAMLSaveOptions(), In_IndentDepth) {}
+
+		/// <param name="Out_OStream">õXg[B</param>
+		/// <param name="In_Options">IvVB</param>
+		/// <param name="In_IndentDepth">ŏʂ̃Rei̗vfoCfgB</param>
+		YAMLEmitter(_Inout_ std::ostream& Out_OStream, _In_ const YAMLSaveOptions& In_Options, _In_ const int& In_IndentDepth = 0)
+			: m_OStream(Out_OStream), m_BaseIndent(In_IndentDepth), m_Options(In_Options)
 		{
-			std::filesystem::path filePath(In_FilePath);
-			std::filesystem::path dirPath = filePath.parent_path();
-			if (!dirPath.empty() && !std::filesystem::exists(dirPath))
+			m_Frames.reserve(16);
+		}
+
+		void OnMapStart() { Open(true); }
+		void OnSeqStart() { Open(false); }
+		void OnMapEnd() { Close(); }
+		void OnSeqEnd() { Close(); }
+
+		void OnKey(_In_ std::string_view In_Key)
+		{
+			if (m_Frames.empty()) return;
+			Frame& frame = m_Frames.back();
+			BeginBlock(frame);
+			WriteIndent(m_OStream, frame.indent);
+			m_OStream << In_Key << ":";
+		}
+
+		void OnScalar(_In_ std::string_view In_Value, _In_ const YAMLNode::MultilineType& In_MultilineType)
+		{
+			if (m_Frames.empty())
 			{
-				std::filesystem::create_directories(dirPath);
+				m_Anchor.clear();
+				WriteScalar(m_OStream, In_Value, In_MultilineType, m_BaseIndent);
+				if (m_BaseIndent <= 2) m_OStream << "\n";
+				return;
 			}
+			Frame& frame = m_Frames.back();
+			if (frame.flow && m_Anchor.empty() && BufferFlowItem(In_Value, In_MultilineType)) return;
+			BeginBlock(frame);
+			BeginValue(frame);
+			WriteAnchor();
+			WriteScalar(m_OStream, In_Value, In_MultilineType, frame.indent + 2);
 		}
-		catch (const std::exception& e)
+
+		void OnAnchor(_In_ std::string_view In_Name) { m_Anchor.assign(In_Name.data(), In_Name.size()); }
+
+		void OnAlias(_In_ std::string_view In_Name)
 		{
-			std::cerr << "fBNg쐬s: " << e.what() << std::endl;
-			return false;
+			m_Anchor.clear();
+			if (m_Frames.empty()) return;
+			Frame& frame = m_Frames.back();
+			BeginBlock(frame);
+			BeginValue(frame);
+			m_OStream << " *" << In_Name << "\n";
 		}
 
-		std::ofstream ofs(In_FilePath, std::ios::binary);
-		if (!ofs)
+	private:
+		struct Frame
 		{
-			std::cerr << "t@Cۑł܂: " << In_FilePath << std::endl;
-			return false;
+			int indent;		// vfoCfg
+			bool isMap;
+			bool started;	// ǒ̉soς݂(ŏ̗vf܂ŕۗ)
+			bool flow;		// t[`ŏõV[PX(vf m_FlowItems ɕۗ)
+		};
+
+		// V[PX̗vf͒l̑O "-" o(}bv̗vf OnKey ŏoς)
+		void BeginValue(_In_ const Frame& In_Frame)
+		{
+			if (In_Frame.isMap) return;
+			WriteIndent(m_OStream, In_Frame.indent);
+			m_OStream << "-";
 		}
 
-		WriteYAMLNode(ofs, m_YAMLData, 0);
+		// ۗ̃AJ[l̑Oɏo
+		void WriteAnchor()
+		{
+			if (m_Anchor.empty()) return;
+			m_OStream << " &" << m_Anchor;
+			m_Anchor.clear();
+		}
 
-		if (!ofs)
+		// ReiubN`ŏon߂Bt[`̌₾ꍇ͕ۗĂvfo
+		void BeginBlock(_Inout_ Frame& In_Frame)
 		{
-			std::cerr << "t@C݃G[: " << In_FilePath << std::endl;
-			return false;
+			if (In_Frame.started) return;
+			In_Frame.started = true;
+			m_OStream << "\n";
+			if (!In_Frame.flow) return;
+
+			In_Frame.flow = false;
+			size_t begin = 0;
+			for (const size_t end : m_FlowEnds)
+			{
+				WriteIndent(m_OStream, In_Frame.indent);
+				m_OStream << "-";
+				WriteScalar(m_OStream, std::string_view(m_FlowItems).substr(begin, end - begin), YAMLNode::MultilineType::None, In_Frame.indent + 2);
+				begin = end;
+			}
+			m_FlowItems.clear();
+			m_FlowEnds.clear();
 		}
-		return true;
+
+		// t[`̗vfƂĕۗłꍇ true Ԃ
+		bool BufferFlowItem(_In_ std::string_view In_Value, _In_ const YAMLNode::MultilineType& In_MultilineType)
+		{
+			if (In_MultilineType != YAMLNode::MultilineType::None || In_Value.empty() ||
+				m_FlowEnds.size() >= m_Options.flowSequenceMaxItems) return false;
+			// t[`̋؂ƕ镶Ő󔒂܂ޒl̓ubN`ɂ
+			if (In_Value.find_first_of(",[]{}#\r\n") != std::string_view::npos ||
+				(NeedsQuotes(In_Value) && !IsQuotedScalar(In_Value))) return false;
+			// "[" "]" ƗvfԂ ", " ܂߂
+			if (m_FlowItems.size() + In_Value.size() + 2 * (m_FlowEnds.size() + 1) > m_Options.flowSequenceMaxWidth) return false;
+
+			m_FlowItems += In_Value;
+			m_FlowEnds.push_back(m_FlowItems.size());
+			return true;
+		}
+
+		void Open(_In_ const bool& In_IsMap)
+		{
+			if (m_Frames.empty())
+			{
+				m_Anchor.clear();
+				m_Frames.push_back({ m_BaseIndent, In_IsMap, true, false });
+				return;
+			}
+			Frame& parent = m_Frames.back();
+			BeginBlock(parent);
+			BeginValue(parent);
+			WriteAnchor();
+			const int indent = parent.indent + 2;
+			m_Frames.push_back({ indent, In_IsMap, false, !In_IsMap && m_Options.flowSequenceMaxItems > 0 });
+		}
+
+		void Close()
+		{
+			if (m_Frames.empty()) return;
+			const Frame frame = m_Frames.back();
+			m_Frames.pop_back();
+			if (!frame.started)
+			{
+				// vfȂA܂̓t[`Ɏ܂Rei̓XJ[Ɠ1sŏo
+				if (frame.isMap)
+				{
+					m_OStream << " {}\n";
+					return;
+				}
+				m_OStream << " [";
+				size_t begin = 0;
+				for (const size_t end : m_FlowEnds)
+				{
+					if (begin != 0) m_OStream << ", ";
+					m_OStream << std::string_view(m_FlowItems).substr(begin, end - begin);
+					begin = end;
+				}
+				m_OStream << "]\n";
+				m_FlowItems.clear();
+				m_FlowEnds.clear();
+				return;
+			}
+			// Cfg[x2ȉ̏ꍇ(ԑ傫ȍڂ)͍Ōɉsǉ
+			if (frame.indent <= 2) m_OStream << "\n";
+		}
+
+		std::ostream& m_OStream;
+		int m_BaseIndent;
+		YAMLSaveOptions m_Options;
+		std::vector<Frame> m_Frames;
+		std::string m_FlowItems;			// t[`̌̃V[PX̗vf(؂ȂŘA)
+		std::vector<size_t> m_FlowEnds;		// m_FlowItems ̊evf̏I[ʒu
+		std::string m_Anchor;				// ̒lɕtAJ[
+	};
+
+	YAMLParser() : YAMLParser(std::pmr::get_default_resource()) {}
+
+	/// <summary>
+	/// m[h̊mۂɎg\[Xw肵ăp[T[쐬܂B
+	/// p[XҏWŐm[h{́AAReiׂ͂Ẵ\[Xmۂ܂B
+	/// \[X́Ãp[T[Ƃ̃Rs[AFork p[T[A擾m[hׂĔj܂ŗLłKv܂B
+	/// ̃Xbhm[h\ꍇ(YAMLConcurrentDocument Ȃ)̓XbhZ[tȃ\[XnĂB
+	/// </summary>
+	/// <param name="In_Resource">m[h̊mۂɎg\[XB</param>
+	explicit YAMLParser(_In_ std::pmr::memory_resource* In_Resource)
+		: m_Resource(In_Resource), m_YAMLData(YAMLMap(In_Resource)) {}
+
+	/// <summary>
+	/// m[h̊mۂɎgĂ郁\[X擾܂B
+	/// </summary>
+	inline std::pmr::memory_resource* GetResource() const noexcept { return m_Resource; }
+
+	/// <summary>
+	/// Ȍo͐ݒ肵܂Bݒ܂͋̊֐nꍇ͕WG[o͂ɏo܂B
+	/// ̃Xbhp[XɌĂяoȂłB
+	/// </summary>
+	/// <param name="In_Sink">O󂯎֐B</param>
+	static void SetLogSink(_In_ LogSink In_Sink)
+	{
+		GetLogSinkStorage() = std::move(In_Sink);
 	}
 
 	/// <summary>
-	/// YAMLf[^擾܂B
+	/// ݒ肳ꂽȌo͐ɃbZ[W𑗂܂B
 	/// </summary>
-	/// <returns>o[ϐm_YAMLData̒lԂ܂B</returns>
-	inline YAMLNode GetYAMLData() const noexcept { return m_YAMLData; }
+	/// <param name="In_Level">ȌdvxB</param>
+	/// <param name="In_Message">bZ[WB</param>
+	static void Log(_In_ const LogLevel& In_Level, _In_ const std::string& In_Message)
+	{
+		const LogSink& sink = GetLogSinkStorage();
+		if (sink) sink(In_Level, In_Message);
+		else std::cerr << In_Message << std::endl;
+	}
 
+#if defined(YAMLPARSER_ENABLE_STATS)
 	/// <summary>
-	/// L[pXŕl擾
+	/// ߂ ParseYAML ̓v擾܂Bۑ̓v SaveYAML  Out_Stats Ŏ󂯎܂B
 	/// </summary>
-	/// <param name="In_keyPath">YAML̃L[̃pXihbg؂jB: "users.0.name"</param>
-	/// <param name="In_IncludeQuotes">̑OɈp܂߂邩ǂBftHgfalseB</param>
-	/// <returns>w肳ꂽL[̒l𕶎ƂĕԂ܂BL[݂Ȃꍇ͋󕶎Ԃ܂B</returns>
-	inline std::string GetString(_In_ const std::string& In_keyPath, _In_ const bool& In_IncludeQuotes = false) const
+	inline const YAMLStats& GetStats() const noexcept { return m_Stats; }
+#endif
+
+	/// <summary>
+	/// ߂ ParseYAML ܂ ParseYAMLBuffer ŌA͏̈ʒȕɎ擾܂B
+	/// p[Xł؂(Error)ɉāAOɂ͏o͂Ȃǂݔ΂sAłȂGCAXE}[WL[(Warning)܂݂܂B肪Ȃ΋łB
+	/// </summary>
+	inline const std::vector<YAMLDiagnostic>& GetDiagnostics() const noexcept { return m_Diagnostics; }
+
+	/// <summary>
+	/// w肳ꂽt@CpXYAMLt@Cǂݍ݁Ap[X܂B
+	/// </summary>
+	/// <param name="In_FilePath">ǂݍYAMLt@C̃pXB</param>
+	/// <returns>p[Xɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	bool ParseYAML(_In_ const std::string& In_FilePath)
 	{
-		const YAMLScalar* val = FindScalarByPath(In_keyPath);
-		if (!val) return "";
-		if (In_IncludeQuotes) return *val;
+		if (In_FilePath.empty()) return false;
 
-		std::string result = *val;
-		// Ő󔒁Es폜
-		result.erase(0, result.find_first_not_of(" \t\n\r"));
-		result.erase(result.find_last_not_of(" \t\n\r") + 1);
-		// ̐`
-		if (!result.empty() && result.front() == '"' && result.back() == '"')
-			result = result.substr(1, result.size() - 2);
-		else if (!result.empty() && result.front() == '\'' && result.back() == '\'')
-			result = result.substr(1, result.size() - 2);
+		YAMLPARSER_STATS(m_Stats = YAMLStats{});
+		m_Diagnostics.clear();
+		if (IsParseCancelled(m_ParseControl)) return false;
 
-		return result;
+		// f[^̓ǂݍ݂UTF-8Shift_JISւ̕ϊ
+		std::string text;
+		if (!ReadText(In_FilePath, m_ParseLimits.maxTotalBytes, text YAMLPARSER_STATS(, &m_Stats))) return false;
+		if (m_ParseControl && m_ParseControl->onProgress) m_ParseControl->onProgress({ YAMLProgress::Stage::Read, text.size(), text.size() });
+		if (!ParseText(text)) return false;
+		if (m_KeepSourceSpans) BindSourceFile(In_FilePath);
+		return true;
 	}
 
 	/// <summary>
-	/// L[pXbool擾
+	/// YAMLeLXgp[X܂Bt@Cǂݍ񂾏ꍇƓR[h̕ϊsĂp[X܂B
+	/// 1̃t@C̈ꕔ(YAMLDocumentStream ؂ohLgȂ)p[XꍇɎg܂B
 	/// </summary>
-	/// <param name="In_keyPath">YAML̃L[̃pXihbg؂jB: "users.0.name"</param>
-	/// <returns>w肳ꂽL[̒lboolƂĕԂ܂BL[݂ȂꍇfalseԂ܂B</returns>
-	inline bool GetBool(_In_ const std::string& In_keyPath) const
+	/// <param name="In_Source">p[XeLXgB</param>
+	/// <returns>p[Xɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	bool ParseYAMLBuffer(_In_ const std::string& In_Source)
 	{
-		const YAMLScalar* val = FindScalarByPath(In_keyPath);
-		if (!val) return false;
-		return (*val == "true" || *val == "True" || *val == "1");
+		YAMLPARSER_STATS(m_Stats = YAMLStats{});
+		YAMLPARSER_STATS(auto phaseStart = std::chrono::steady_clock::now());
+		YAMLPARSER_STATS(m_Stats.bytesRead = In_Source.size());
+		m_Diagnostics.clear();
+		if (!CheckTotalBytes(In_Source.size(), m_ParseLimits.maxTotalBytes, "obt@")) return false;
+
+		std::string text = Convert_UTF8_To_ShiftJIS(In_Source);
+		YAMLPARSER_STATS(MarkPhase(m_Stats.transcodeTime, phaseStart));
+		return ParseText(text);
 	}
 
 	/// <summary>
-	/// L[pXint擾
+	/// Cxgʒm֐m[hc[gݗāAYAMLf[^Ƃĕێ܂BJSONȂYAMLȊǑ`ǂݍޏꍇɎg܂B
+	/// ֐͎󂯎nh[ ParseEvents Ɠ`̃CxgʒmAꍇ true ԂĂB
+	/// ̓p[T[̕R[h(ConvertFromUTF8 Q)ŒʒmĂB
 	/// </summary>
-	/// <param name="In_keyPath">YAML̃L[̃pXihbg؂jB: "users.0.age"</param>
-	/// <returns>w肳ꂽL[̒lintƂĕԂ܂BϊɎsꍇ0Ԃ܂B</returns>
-	inline int GetInt(_In_ const std::string& In_keyPath) const
+	/// <param name="In_Producer">nh[󂯎Abool Ԃ֐B</param>
+	/// <returns>ŏʂ}bṽc[gݗĂꂽꍇ trueAsꍇ͈ȑOYAMLf[^ێ܂ false Ԃ܂B</returns>
+	template <class Producer>
+	bool LoadEvents(_In_ Producer&& In_Producer)
 	{
-		const YAMLScalar* val = FindScalarByPath(In_keyPath);
-		if (!val) return 0;
-		int value = 0;
-		auto [ptr, ec] = std::from_chars(val->data(), val->data() + val->size(), value, 10);
-		if (ec == std::errc()) return value;
-		else
+		YAMLPARSER_STATS(m_Stats = YAMLStats{});
+		YAMLPARSER_STATS(auto phaseStart = std::chrono::steady_clock::now());
+
+		TreeBuilder builder(m_Resource);
+		builder.denseThreshold = m_DenseArrayThreshold;
+		builder.poolScalars = m_PoolScalars;
+		YAMLPARSER_STATS(builder.stats = &m_Stats);
+		if (!In_Producer(builder)) return false;
+		if (!builder.root || builder.root->type != YAMLNode::Type::Map || !builder.stack.empty())
 		{
-			std::cerr << "ϊs: " << *val << std::endl;
-			return 0;
+			Log(LogLevel::Error, "ŏʂ}bṽhLgł͂܂B");
+			return false;
 		}
+		AdoptTree(builder, SourceLayout());
+		YAMLPARSER_STATS(MarkPhase(m_Stats.treeBuildTime, phaseStart));
+		return true;
 	}
 
 	/// <summary>
-	/// L[pXfloat擾
+	/// w肳ꂽYAMLt@Cm[hc[\zɃp[XA\CxgƂănh[ɒʒm܂B
+	/// hLgŜ OnMapStart  OnMapEnd ܂ł1̃}bvƂĒʒm܂B
 	/// </summary>
-	/// <param name="In_keyPath">YAML̃L[̃pXihbg؂jB: "users.0.height"</param>
-	/// <returns>w肳ꂽL[̒lfloatƂĕԂ܂BϊɎsꍇ0.0fԂ܂B</returns>
-	inline float GetFloat(_In_ const std::string& In_keyPath) const
+	/// <param name="In_FilePath">ǂݍYAMLt@C̃pXB</param>
+	/// <param name="In_Handler">Cxg󂯎nh[(YAMLEventHandler Q)B</param>
+	/// <param name="In_Limits">p[X̏Bꍇ͂̎_ŃCxg̒ʒm߂܂B</param>
+	/// <param name="Out_Diagnostics">̒ǉ(GetDiagnostics Q)Bnullptr ̏ꍇ͋L^܂B</param>
+	/// <returns>t@C̓ǂݍ݂ƃp[Xɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	template <class Handler>
+	static bool ParseEvents(_In_ const std::string& In_FilePath, _Inout_ Handler&& In_Handler, _In_ const YAMLParseLimits& In_Limits = YAMLParseLimits(),
+		_Out_opt_ std::vector<YAMLDiagnostic>* Out_Diagnostics = nullptr)
 	{
-		const YAMLScalar* val = FindScalarByPath(In_keyPath);
-		if (!val) return 0.0f;
-		try
-		{
-			return std::stof(*val);
-		}
-		catch (const std::invalid_argument& e)
-		{
-			std::cerr << "_ϊs: " << e.what() << std::endl;
-		}
-		catch (const std::out_of_range& e)
+		if (In_FilePath.empty()) return false;
+
+		std::string text;
+		if (!ReadText(In_FilePath, In_Limits.maxTotalBytes, text)) return false;
+		YAMLLines yamlLines;
+		yamlLines.limits = In_Limits;
+		SplitLines(text, yamlLines.lines);
+		const size_t reported = Out_Diagnostics ? Out_Diagnostics->size() : 0;
+		yamlLines.diagnostics = Out_Diagnostics;
+		const bool succeeded = ParseDocument(yamlLines, In_Handler);
+		if (Out_Diagnostics && Out_Diagnostics->size() != reported) MapDiagnosticsToSource(text, *Out_Diagnostics, reported);
+		return succeeded;
+	}
+
+	/// <summary>
+	/// \zς݂̃m[hAParseEvents Ɠ`̃CxgƂănh[ɒʒm܂B}bv̗vf̓nbVɒʒm܂B
+	/// </summary>
+	/// <param name="In_Node">ʒmm[hB</param>
+	/// <param name="In_Handler">Cxg󂯎nh[B</param>
+	template <class Handler>
+	static void EmitEvents(_In_ const YAMLNode& In_Node, _Inout_ Handler&& In_Handler)
+	{
+		switch (In_Node.type)
+		{
+		case YAMLNode::Type::Scalar:
+			In_Handler.OnScalar(std::get<YAMLScalar>(In_Node.value), In_Node.multilineType);
+			break;
+		case YAMLNode::Type::Sequence:
+			In_Handler.OnSeqStart();
+			for (const auto& child : std::get<YAMLSeq>(In_Node.value))
+				EmitEvents(*child, In_Handler);
+			In_Handler.OnSeqEnd();
+			break;
+		case YAMLNode::Type::Map:
+			In_Handler.OnMapStart();
+			for (const auto& keyValue : std::get<YAMLMap>(In_Node.value))
+			{
+				In_Handler.OnKey(keyValue.first);
+				EmitEvents(*keyValue.second, In_Handler);
+			}
+			In_Handler.OnMapEnd();
+			break;
+		case YAMLNode::Type::NumericArray:
 		{
-			std::cerr << "_͈͊O: " << e.what() << std::endl;
+			const auto& array = std::get<YAMLNumericArray>(In_Node.value);
+			char buffer[YAMLNumericArray::FormatBufferSize];
+			In_Handler.OnSeqStart();
+			for (size_t i = 0; i < array.size(); ++i)
+				In_Handler.OnScalar(array.Format(i, buffer), YAMLNode::MultilineType::None);
+			In_Handler.OnSeqEnd();
+			break;
+		}
 		}
-		return 0.0f;
 	}
 
 	/// <summary>
-	/// L[pXdouble擾
+	/// hLgŜ EmitEvents Ɠ`̃CxgƂănh[ɒʒm܂B
+	/// ǂݍݎɃAJ[(&amp;name)tĂm[h OnAnchor tĒʒmAm[hĂьꂽӏ OnAlias Œʒm܂B
+	/// }[WL[(&lt;&lt;)Ŏ荞񂾗vf́A荞݌ʒmς݂ł "&lt;&lt;" ̃GCAXƁA荞݌ƈقȂvfŒʒm܂B
+	/// ύXɂċLm[h͒ʏ̃m[hƂĒʒm邽߁Anh[QƂΏɓeɂȂ܂B
 	/// </summary>
-	/// <param name="In_keyPath">YAML̃L[̃pXihbg؂jB: "users.0.weight"</param>
-	/// <returns>w肳ꂽL[̒ldoubleƂĕԂ܂BϊɎsꍇ0.0Ԃ܂B</returns>
-	inline double GetDouble(_In_ const std::string& In_keyPath) const
+	/// <param name="In_Handler">Cxg󂯎nh[B</param>
+	template <class Handler>
+	void EmitDocumentEvents(_Inout_ Handler&& In_Handler) const
 	{
-		const YAMLScalar* val = FindScalarByPath(In_keyPath);
-		if (!val) return 0.0;
-		try
+		if (m_AnchorNames.empty())
 		{
-			return std::stod(*val);
+			EmitEvents(m_YAMLData, In_Handler);
+			return;
 		}
-		catch (const std::invalid_argument& e)
+		AnchorBindings bindings;
+		EmitAnchoredContent(m_YAMLData, In_Handler, bindings);
+	}
+
+	/// <summary>
+	/// XJ[l̑Ő󔒁EsAOオ΂ɂȂpłΊOԂ܂BGetString Ɠ`łB
+	/// </summary>
+	/// <param name="In_Value">`XJ[lB</param>
+	/// <returns>In_Value ̈ꕔQƂ镶Ԃ܂B</returns>
+	static inline std::string_view UnquoteScalar(_In_ std::string_view In_Value) noexcept
+	{
+		const size_t first = In_Value.find_first_not_of(" \t\n\r");
+		if (first == std::string_view::npos) return std::string_view();
+		In_Value = In_Value.substr(first, In_Value.find_last_not_of(" \t\n\r") - first + 1);
+		if ((In_Value.front() == '"' && In_Value.back() == '"') || (In_Value.front() == '\'' && In_Value.back() == '\''))
+			return In_Value.substr(1, In_Value.size() - 2);
+		return In_Value;
+	}
+
+	/// <summary>
+	/// pň͂܂ɃXJ[ƂďoƁAʂ̒l\Ƃēǂݖ߂邩ǂ𔻒肵܂B
+	/// t[RNVEAJ[EGCAXE^OEubNXJ[ERgEpŎn܂́A"- " "? " ": " Ŏn܂́A
+	/// ": "  " #" ܂ނ́A':' ŏÍAUnquoteScalar ŎŐ󔒂̂Y܂B
+	/// </summary>
+	/// <param name="In_Value">o(p܂܂Ȃl)B</param>
+	/// <returns>pň͂ޕKvꍇ true Ԃ܂B</returns>
+	static inline bool NeedsQuotes(_In_ std::string_view In_Value) noexcept
+	{
+		if (In_Value.empty()) return false;
+		const auto isSpace = [](const char In_Char) { return In_Char == ' ' || In_Char == '\t' || In_Char == '\r' || In_Char == '\n'; };
+		if (isSpace(In_Value.front()) || isSpace(In_Value.back()) || In_Value.back() == ':') return true;
+		switch (In_Value.front())
 		{
-			std::cerr << "_ϊs: " << e.what() << std::endl;
+		case '[': case '{': case '&': case '*': case '!': case '|': case '>': case '#': case '\'': case '"': case '%': case '@': case '`':
+			return true;
+		case '-': case '?': case ':':
+			if (In_Value.size() == 1 || isSpace(In_Value[1])) return true;
+			break;
+		default:
+			break;
 		}
-		catch (const std::out_of_range& e)
+		for (size_t i = 1; i + 1 < In_Value.size(); ++i)
 		{
-			std::cerr << "_͈͊O: " << e.what() << std::endl;
+			if ((In_Value[i] == ':' && isSpace(In_Value[i + 1])) || (In_Value[i] == '#' && isSpace(In_Value[i - 1]))) return true;
 		}
-		return 0.0;
+		return false;
 	}
 
 	/// <summary>
-	/// w肳ꂽL[ pX݂邩ǂ𔻒肵܂B
+	/// p[T[̕R[h(Shift_JIS)̕UTF-8ɕϊ܂BCxgm[h̕t@CO֓nꍇɎg܂B
 	/// </summary>
-	/// <param name="In_keyPath">L[ pX\B</param>
-	/// <returns>L[ pX݂ꍇ trueA݂Ȃꍇ false Ԃ܂B</returns>
-	inline bool HasKey(_In_ const std::string& In_keyPath) const
+	static inline std::string ConvertToUTF8(_In_ std::string_view In_Source) { return Convert_ShiftJIS_To_UTF8(In_Source); }
+
+	/// <summary>
+	/// UTF-8̕p[T[̕R[h(Shift_JIS)ɕϊ܂BLoadEvents ֒ʒm镶̕ϊɎg܂B
+	/// </summary>
+	static inline std::string ConvertFromUTF8(_In_ std::string_view In_Source)
 	{
-		if (In_keyPath.empty()) return false;
-		const YAMLNode* node = &m_YAMLData;
-		size_t pos = 0, next;
-		while (pos < In_keyPath.size())
+		std::string text = Convert_UTF8_To_ShiftJIS(std::string(In_Source));
+		if (!text.empty() && text.back() == '\0') text.pop_back();	// ϊɕtꂽI[
+		return text;
+	}
+
+	/// <summary>
+	/// w肳ꂽt@CpXYAMLf[^ۑ܂B
+	/// </summary>
+	/// <param name="In_FilePath">ۑ̃t@CpXw肵܂B</param>
+	/// <returns>ۑɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	inline bool SaveYAML(_In_ const std::string& In_FilePath) const
+	{
+		return SaveYAML(In_FilePath, YAMLSaveOptions());
+	}
+
+	/// <summary>
+	/// IvVw肵āAw肳ꂽt@CpXYAMLf[^ۑ܂B
+	/// </summary>
+	/// <param name="In_FilePath">ۑ̃t@CpXw肵܂B</param>
+	/// <param name="In_Options">IvVBZV[PXt[`ŏoꍇȂǂɎw肵܂B</param>
+	/// <param name="Out_Stats">YAMLPARSER_ENABLE_STATS `ꍇ̂݁Bo̎ԂƃoCg󂯎܂BȗB</param>
+	/// <returns>ۑɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	inline bool SaveYAML(_In_ const std::string& In_FilePath, _In_ const YAMLSaveOptions& In_Options
+		YAMLPARSER_STATS(, _Out_opt_ YAMLStats* Out_Stats = nullptr)) const
+	{
+		std::ofstream ofs;
+		if (!OpenOutputFile(In_FilePath, ofs)) return false;
+
+		// const ̂ߓv̓o[ɏĂяo֕Ԃ(̃Xbh瓯ɕۑł悤)
+		YAMLPARSER_STATS(auto phaseStart = std::chrono::steady_clock::now());
+		EmitDocumentEvents(YAMLEmitter(ofs, In_Options));
+		YAMLPARSER_STATS(if (Out_Stats) { Out_Stats->serializeTime = {}; MarkPhase(Out_Stats->serializeTime, phaseStart); });
+		YAMLPARSER_STATS(if (Out_Stats) Out_Stats->bytesWritten = ofs ? static_cast<uint64_t>(ofs.tellp()) : 0);
+
+		if (!ofs)
 		{
-			next = In_keyPath.find('.', pos);
-			const std::string token = In_keyPath.substr(pos, next == std::string::npos ? std::string::npos : next - pos);
-			if (node->type == YAMLNode::Type::Map)
-			{
-				const auto& map = std::get<YAMLMap>(node->value);
-				auto itr = map.find(token);
-				if (itr == map.end()) return false;
-				node = itr->second.get();
-			}
-			else if (node->type == YAMLNode::Type::Sequence)
-			{
-				if (!std::all_of(token.begin(), token.end(), ::isdigit)) return false;
-				const size_t idx = std::stoul(token);
-				const auto& seq = std::get<YAMLSeq>(node->value);
-				if (idx >= seq.size()) return false;
-				node = seq[idx].get();
-			}
-			else if (node->type == YAMLNode::Type::Scalar)
-			{
-				// XJ[l̏ꍇAL[ pX̍Ō̕łȂƂmF
-				if (token.empty()) return true;
-				return false;
-			}
-			else
-			{
-				return false;
-			}
-			if (next == std::string::npos) break;
-			pos = next + 1;
+			Log(LogLevel::Error, "t@C݃G[: " + In_FilePath);
+			return false;
 		}
 		return true;
 	}
 
 	/// <summary>
-	/// w肳ꂽL[̃pXɏ]YAMLm[hAm[h̋L|C^Ԃ܂B
+	/// ǂݍ񂾃t@C̏ۂ܂܁ASetString Ȃǂŏl̕ւĕۑ܂B
+	/// RgAL[̏ApAs͌̂܂܎c܂BEnableSourceSpans Lɂēǂݍ񂾏ꍇɎg܂B
+	/// ۑ悪ǂݍ񂾃t@CŁAւl̒ςȂꍇ͂̉ӏ㏑A
+	/// ςꍇ͍ŏɕςʒu낾܂B
+	/// L[̒ǉ^̕ύXȂǒl̍ւŕ\ȂύXꍇ́ASaveYAML ƓŜo܂B
 	/// </summary>
-	/// <param name="In_keyPath">hbg؂̕ŕ\ꂽYAMLm[hւ̃pXB: "root.child.key"</param>
-	/// <returns>pXŎw肳ꂽYAMLm[hstd::shared_ptrBm[hȂꍇnullptrԂ܂B</returns>
-	inline std::shared_ptr<YAMLNode> GetNodeByPath(_In_ const std::string& In_keyPath) const
+	/// <param name="In_FilePath">ۑ̃t@CpXB</param>
+	/// <returns>ۑɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	bool SaveChanges(_In_ const std::string& In_FilePath)
 	{
-		const YAMLNode* node = &m_YAMLData;
-		size_t pos = 0, next;
-		while (pos < In_keyPath.size())
+		if (In_FilePath.empty()) return false;
+
+		std::vector<SourceEdit> edits;
+		std::string path;
+		if (!m_SourceLayout.valid || !CollectSourceEdits(m_YAMLData, path, edits))
 		{
-			next = In_keyPath.find('.', pos);
-			const std::string token = In_keyPath.substr(pos, next == std::string::npos ? std::string::npos : next - pos);
-			if (node->type == YAMLNode::Type::Map)
-			{
-				const auto& map = std::get<YAMLMap>(node->value);
-				auto itr = map.find(token);
-				if (itr == map.end()) return nullptr;
-				node = itr->second.get();
-			}
-			else if (node->type == YAMLNode::Type::Sequence)
-			{
-				if (!std::all_of(token.begin(), token.end(), ::isdigit)) return nullptr;
-				const size_t idx = std::stoul(token);
-				const auto& seq = std::get<YAMLSeq>(node->value);
-				if (idx >= seq.size()) return nullptr;
-				node = seq[idx].get();
-			}
-			else
+			if (m_KeepSourceSpans) Log(LogLevel::Info, "̏̂܂ܕۑłȂύX邽߁AŜo܂: " + In_FilePath);
+			// oeƃ\[XXp͑ΉȂȂ邽߁Aɓǂݍނ܂ŎgȂ
+			m_SourceLayout = SourceLayout();
+			return SaveYAML(In_FilePath);
+		}
+		std::sort(edits.begin(), edits.end(), [](const SourceEdit& In_Left, const SourceEdit& In_Right) { return In_Left.offset < In_Right.offset; });
+		return WriteSourceEdits(In_FilePath, edits);
+	}
+
+	/// <summary>
+	/// ۑ̃fBNgKvɉč쐬At@CݗpɊJ܂Bsꍇ̓Oɏo͂܂B
+	/// </summary>
+	/// <param name="In_FilePath">ۑ̃t@CpXB</param>
+	/// <param name="Out_Stream">Jt@CXg[B</param>
+	/// <returns>Jꍇ trueAsꍇ false Ԃ܂B</returns>
+	static bool OpenOutputFile(_In_ const std::string& In_FilePath, _Out_ std::ofstream& Out_Stream)
+	{
+		if (In_FilePath.empty()) return false;
+
+		try
+		{
+			std::filesystem::path filePath(In_FilePath);
+			std::filesystem::path dirPath = filePath.parent_path();
+			if (!dirPath.empty() && !std::filesystem::exists(dirPath))
 			{
-				return nullptr; // }bvV[PXł͂Ȃꍇ
+				std::filesystem::create_directories(dirPath);
 			}
-			if (next == std::string::npos) break;
-			pos = next + 1;
 		}
-		return std::make_shared<YAMLNode>(*node);
+		catch (const std::exception& e)
+		{
+			Log(LogLevel::Error, std::string("fBNg쐬s: ") + e.what());
+			return false;
+		}
+
+		Out_Stream.open(In_FilePath, std::ios::binary);
+		if (!Out_Stream)
+		{
+			Log(LogLevel::Error, "t@Cۑł܂: " + In_FilePath);
+			return false;
+		}
+		return true;
 	}
 
 	/// <summary>
-	/// w肳ꂽL[̃pXɏ]YAMLf[^̃XJ[lݒ肵܂B
+	/// ͍ς݂YAMLf[^oCiXibvVbgƂĕۑ܂B
+	/// YAMLt@C̃pXw肷ƁÃTCYƍXVwb_[ɋL^Aǂݍݎ̑NxmFɎg܂B
 	/// </summary>
-	/// <param name="In_keyPath">ݒΏۂ̒l̃pXihbg؂̕jB</param>
-	/// <param name="In_Value">ݒ肷镶lB</param>
-	/// <returns>l̐ݒɐꍇtrueAsꍇfalseԂ܂B</returns>
-	bool SetString(_In_ const std::string& In_keyPath, _In_ const std::string& In_Value)
+	/// <param name="In_FilePath">ۑ̃XibvVbgt@C̃pXB</param>
+	/// <param name="In_SourcePath">XibvVbǧɂȂYAMLt@C̃pXBȗB</param>
+	/// <returns>ۑɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	bool SaveBinary(_In_ const std::string& In_FilePath, _In_ const std::string& In_SourcePath = "") const
 	{
-		if (In_keyPath.empty()) return false;
-		if (!HasKey(In_keyPath)) // L[pX݂Ȃꍇ͐VKɐ
-			GenerateNode(In_keyPath, YAMLNode::Type::Scalar);
+		if (In_FilePath.empty()) return false;
 
-		YAMLNode* node = &m_YAMLData;
-		size_t pos = 0, next;
-		while (pos < In_keyPath.size())
+		BinaryHeader header{};
+		std::memcpy(header.magic, BinaryMagic, sizeof(header.magic));
+		header.version = BinaryVersion;
+		header.byteOrder = BinaryByteOrder;
+		if (!In_SourcePath.empty() && !GetSourceIdentity(In_SourcePath, header.sourceSize, header.sourceTime))
 		{
-			next = In_keyPath.find('.', pos);
-			const std::string token = In_keyPath.substr(pos, next == std::string::npos ? std::string::npos : next - pos);
-			try
+			Log(LogLevel::Error, "XibvVbg̃t@CmFł܂: " + In_SourcePath);
+			return false;
+		}
+
+		// A肪Ńm[h𕽒R(q̃CfbNX͏ɐe菬A[g͖ɂȂ)
+		// GCAXȂǂŋLĂm[h͈xoAQƂ鑤͂̃CfbNXw
+		std::unordered_map<const YAMLNode*, uint32_t> nodeIds;
+		std::vector<const YAMLNode*> order;
+		{
+			std::vector<std::pair<const YAMLNode*, bool>> stack{ { &m_YAMLData, false } };
+			while (!stack.empty())
 			{
-				if (node->type == YAMLNode::Type::Map)
+				const auto [node, expanded] = stack.back();
+				stack.pop_back();
+				if (nodeIds.count(node) != 0) continue;
+				if (expanded)
 				{
-					auto& map = std::get<YAMLMap>(node->value);
-					auto itr = map.find(token);
-					if (itr == map.end())
-					{
-						map[token] = std::make_shared<YAMLNode>(YAMLScalar{});
-						itr = map.find(token);
-					}
-					node = itr->second.get();
+					nodeIds.emplace(node, static_cast<uint32_t>(order.size()));
+					order.push_back(node);
+					continue;
 				}
-				else if (node->type == YAMLNode::Type::Sequence)
+				stack.emplace_back(node, true);
+				if (node->type == YAMLNode::Type::Sequence)
 				{
-					if (!std::all_of(token.begin(), token.end(), ::isdigit))
-					{
-						std::cerr << "SetString: V[PXm[hɐlȊÕCfbNXw肪܂: " << token << std::endl;
-						return false;
-					}
-					const size_t idx = std::stoul(token);
-					auto& seq = std::get<YAMLSeq>(node->value);
-					if (idx >= seq.size())
-					{
-						std::cerr << "SetString: V[PXCfbNX͈͊Oł: " << idx << std::endl;
-						return false;
-					}
-					node = seq[idx].get();
+					const auto& seq = std::get<YAMLSeq>(node->value);
+					for (auto itr = seq.rbegin(); itr != seq.rend(); ++itr)
+						if (nodeIds.count(itr->get()) == 0) stack.emplace_back(itr->get(), false);
 				}
-				else
+				else if (node->type == YAMLNode::Type::Map)
 				{
-					std::cerr << "SetString: m[h^MapłSequenceł܂B" << std::endl;
-					return false;
+					for (const auto& keyValue : std::get<YAMLMap>(node->value))
+						if (nodeIds.count(keyValue.second.get()) == 0) stack.emplace_back(keyValue.second.get(), false);
 				}
 			}
-			catch (const std::bad_variant_access& e)
+		}
+
+		std::vector<BinaryNode> nodes;
+		std::vector<BinaryChild> children;
+		std::vector<BinaryString> strings;
+		std::string stringData;
+		std::unordered_map<std::string_view, uint32_t> stringIds;
+		const auto intern = [&](std::string_view In_Str) -> uint32_t
 			{
-				std::cerr << "SetString: m[h^valuevariant^v܂: " << e.what() << std::endl;
-				return false;
+				const auto itr = stringIds.find(In_Str);
+				if (itr != stringIds.end()) return itr->second;
+				const uint32_t id = static_cast<uint32_t>(strings.size());
+				strings.push_back({ stringData.size(), In_Str.size() });
+				stringData += In_Str;
+				stringIds.emplace(In_Str, id);
+				return id;
+			};
+
+		nodes.reserve(order.size());
+		for (const YAMLNode* current : order)
+		{
+			const YAMLNode& node = *current;
+			BinaryNode binNode{};
+			binNode.type = static_cast<uint8_t>(node.type);
+			binNode.multilineType = static_cast<uint8_t>(node.multilineType);
+			switch (node.type)
+			{
+			case YAMLNode::Type::Scalar:
+				binNode.value = intern(std::get<YAMLScalar>(node.value));
+				break;
+			case YAMLNode::Type::Sequence:
+			{
+				const auto& seq = std::get<YAMLSeq>(node.value);
+				binNode.value = static_cast<uint32_t>(children.size());
+				binNode.count = static_cast<uint32_t>(seq.size());
+				for (const auto& child : seq)
+					children.push_back({ BinaryNoKey, nodeIds.at(child.get()) });
+				break;
 			}
-			catch (const std::exception& e)
+			case YAMLNode::Type::Map:
 			{
-				std::cerr << "SetString: O: " << e.what() << std::endl;
-				return false;
+				const auto& map = std::get<YAMLMap>(node.value);
+				binNode.value = static_cast<uint32_t>(children.size());
+				binNode.count = static_cast<uint32_t>(map.size());
+				for (const auto& keyValue : map)
+					children.push_back({ intern(keyValue.first), nodeIds.at(keyValue.second.get()) });
+				break;
 			}
-			if (next == std::string::npos) break;
-			pos = next + 1;
-		}
-		if (node->type != YAMLNode::Type::Scalar)
-		{
-			std::cerr << "SetString: ŏIm[h^Scalarł͂܂B" << std::endl;
-			return false;
-		}
-		try
-		{
-			node->value = In_Value; // lݒ
+			case YAMLNode::Type::NumericArray:
+			{
+				// vf͂̂܂܂̃oCgƂĕ̈ɒu(vf̌^ multilineTypeǍ+1  reserved)
+				const auto& array = std::get<YAMLNumericArray>(node.value);
+				binNode.multilineType = static_cast<uint8_t>(array.elementType);
+				binNode.reserved = static_cast<uint16_t>(array.precision + 1);
+				binNode.count = static_cast<uint32_t>(array.size());
+				binNode.value = (array.elementType == YAMLNumericArray::ElementType::Int64)
+					? intern(std::string_view(reinterpret_cast<const char*>(array.ints.data()), array.ints.size() * sizeof(int64_t)))
+					: intern(std::string_view(reinterpret_cast<const char*>(array.doubles.data()), array.doubles.size() * sizeof(double)));
+				break;
+			}
+			}
+			nodes.push_back(binNode);
 		}
-		catch (const std::bad_variant_access& e)
+
+		header.nodeCount = nodes.size();
+		header.childCount = children.size();
+		header.stringCount = strings.size();
+		header.stringDataSize = stringData.size();
+		// ǂݍݎɃ}bṽGĝ܂܎QƂł悤AeZNV̐擪𑵂
+		header.nodeOffset = AlignBinaryOffset(sizeof(BinaryHeader));
+		header.childOffset = AlignBinaryOffset(header.nodeOffset + nodes.size() * sizeof(BinaryNode));
+		header.stringOffset = AlignBinaryOffset(header.childOffset + children.size() * sizeof(BinaryChild));
+		header.stringDataOffset = AlignBinaryOffset(header.stringOffset + strings.size() * sizeof(BinaryString));
+
+		std::ofstream ofs(In_FilePath, std::ios::binary);
+		if (!ofs)
 		{
-			std::cerr << "SetString: lݒ莞variant^sv: " << e.what() << std::endl;
+			Log(LogLevel::Error, "t@Cۑł܂: " + In_FilePath);
 			return false;
 		}
-		catch (const std::exception& e)
+		static constexpr char Padding[alignof(uint64_t)] = {};
+		uint64_t written = 0;
+		const auto writeSection = [&](uint64_t In_Offset, const void* In_Data, uint64_t In_Size)
+			{
+				ofs.write(Padding, static_cast<std::streamsize>(In_Offset - written));
+				ofs.write(static_cast<const char*>(In_Data), static_cast<std::streamsize>(In_Size));
+				written = In_Offset + In_Size;
+			};
+		writeSection(0, &header, sizeof(header));
+		writeSection(header.nodeOffset, nodes.data(), nodes.size() * sizeof(BinaryNode));
+		writeSection(header.childOffset, children.data(), children.size() * sizeof(BinaryChild));
+		writeSection(header.stringOffset, strings.data(), strings.size() * sizeof(BinaryString));
+		writeSection(header.stringDataOffset, stringData.data(), stringData.size());
+		if (!ofs)
 		{
-			std::cerr << "SetString: lݒ莞ɗO: " << e.what() << std::endl;
+			Log(LogLevel::Error, "t@C݃G[: " + In_FilePath);
 			return false;
 		}
 		return true;
 	}
 
 	/// <summary>
-	/// w肳ꂽL[ɐlݒ肵܂B
-	/// </summary>
-	/// <param name="In_keyPath">lݒ肷L[̃pXB</param>
-	/// <param name="In_Value">ݒ肷鐮lB</param>
-	/// <returns>l̐ݒ肪ꍇ trueAsꍇ false Ԃ܂B</returns>
-	/// <summary>
-	/// w肳ꂽL[ɐlݒ肵܂B
+	/// SaveBinary ŕۑXibvVbg}bvœǂݍ݁AYAMLf[^𕜌܂B
+	/// YAMLt@C̃pXw肵ꍇATCYƍXVwb_[ƈvȂΎs܂B
+	/// ŏʂ̃m[h}bvłȂXibvVbg͉Ă̂Ƃēǂݍ݂܂BGetDiagnostics ̌ʂ͋ɂȂ܂B
 	/// </summary>
-	/// <param name="In_keyPath">lݒ肷L[̃pXB</param>
-	/// <param name="In_Value">ݒ肷鐮lB</param>
-	/// <returns>l̐ݒ肪ꍇ trueAsꍇ false Ԃ܂B</returns>
-	inline bool SetInt(_In_ const std::string& In_keyPath, _In_ const int& In_Value)
+	/// <param name="In_FilePath">ǂݍރXibvVbgt@C̃pXB</param>
+	/// <param name="In_SourcePath">NxmFɎgYAMLt@C̃pXBȗ͊mF܂B</param>
+	/// <returns>ǂݍ݂ɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	bool LoadBinary(_In_ const std::string& In_FilePath, _In_ const std::string& In_SourcePath = "")
 	{
-		return SetString(In_keyPath, std::to_string(In_Value));
-	}
+		if (In_FilePath.empty()) return false;
+		m_Diagnostics.clear();
 
-	/// <summary>
-	/// w肳ꂽL[ɑ΂Đ^Ulݒ肵܂B
-	/// </summary>
-	/// <param name="In_keyPath">lݒ肷Ώۂ̃L[̃pXB</param>
-	/// <param name="In_Value">ݒ肷^UlBtrue ܂ falseB</param>
-	/// <returns>l̐ݒ肪ꍇ trueAsꍇ false Ԃ܂B</returns>
-	inline bool SetBool(_In_ const std::string& In_keyPath, _In_ const bool& In_Value)
-	{
-		return SetString(In_keyPath, In_Value ? "true" : "false");
-	}
+		MappedFile file;
+		if (!file.Open(In_FilePath) || file.size() < sizeof(BinaryHeader)) return false;
 
-	/// <summary>
-	/// w肳ꂽL[ɑΉlƂāAfloat^̒l𕶎ƂĐݒ肵܂B
-	/// </summary>
-	/// <param name="In_keyPath">lݒ肷Ώۂ̃L[̃pXB</param>
-	/// <param name="In_Value">ݒ肷float^̒lB</param>
-	/// <returns>l̐ݒ肪ꍇtrueAsꍇfalseԂ܂B</returns>
-	inline bool SetFloat(_In_ const std::string& In_keyPath, _In_ const float& In_Value)
-	{
+		BinaryHeader header;
+		std::memcpy(&header, file.data(), sizeof(header));
+		if (std::memcmp(header.magic, BinaryMagic, sizeof(header.magic)) != 0 ||
+			header.version != BinaryVersion || header.byteOrder != BinaryByteOrder)
+			return false;
+
+		if (!In_SourcePath.empty())
+		{
+			uint64_t sourceSize = 0;
+			int64_t sourceTime = 0;
+			if (!GetSourceIdentity(In_SourcePath, sourceSize, sourceTime) ||
+				sourceSize != header.sourceSize || sourceTime != header.sourceTime)
+				return false;
+		}
+
+		// eZNVʒun܂At@CɎ܂Ă邩mF
+		const uint64_t fileSize = file.size();
+		const auto fits = [fileSize](uint64_t In_Offset, uint64_t In_Count, uint64_t In_Size)
+			{ return In_Offset % alignof(uint64_t) == 0 && In_Offset <= fileSize && In_Count <= (fileSize - In_Offset) / In_Size; };
+		if (header.nodeCount == 0 ||
+			!fits(header.nodeOffset, header.nodeCount, sizeof(BinaryNode)) ||
+			!fits(header.childOffset, header.childCount, sizeof(BinaryChild)) ||
+			!fits(header.stringOffset, header.stringCount, sizeof(BinaryString)) ||
+			!fits(header.stringDataOffset, header.stringDataSize, 1))
+			return false;
+
+		const char* base = file.data();
+		const BinaryNode* nodes = reinterpret_cast<const BinaryNode*>(base + header.nodeOffset);
+		const BinaryChild* children = reinterpret_cast<const BinaryChild*>(base + header.childOffset);
+		const BinaryString* strings = reinterpret_cast<const BinaryString*>(base + header.stringOffset);
+		const char* stringData = base + header.stringDataOffset;
+		// Ō̃m[h[gɂȂ邽߁AParseYAML Ɠŏʂ̓}bvɌ
+		if (nodes[header.nodeCount - 1].type != static_cast<uint8_t>(YAMLNode::Type::Map)) return false;
+
+		const auto getString = [&](uint32_t In_Id, std::string_view& Out_Str) -> bool
+			{
+				if (In_Id >= header.stringCount) return false;
+				const BinaryString& str = strings[In_Id];
+				if (str.offset > header.stringDataSize || str.length > header.stringDataSize - str.offset) return false;
+				Out_Str = std::string_view(stringData + str.offset, str.length);
+				return true;
+			};
+
+		// q͐eOɕł邽߁A擪gݗĂΎq͏ɍ\zς݂ɂȂ
+		std::vector<std::shared_ptr<YAMLNode>> built(header.nodeCount);
+		// ͕ۑɏdĂ邽߁ÃXJ[͔ԍŋLł
+		std::unordered_map<uint32_t, std::shared_ptr<YAMLNode>> scalarPool;
+		for (uint64_t i = 0; i < header.nodeCount; ++i)
+		{
+			const BinaryNode& binNode = nodes[i];
+			if (binNode.type == static_cast<uint8_t>(YAMLNode::Type::Scalar))
+			{
+				const bool poolable = m_PoolScalars && binNode.multilineType == static_cast<uint8_t>(YAMLNode::MultilineType::None);
+				if (poolable)
+				{
+					const auto itr = scalarPool.find(binNode.value);
+					if (itr != scalarPool.end())
+					{
+						built[i] = itr->second;
+						continue;
+					}
+				}
+				std::string_view scalar;
+				if (!getString(binNode.value, scalar)) return false;
+				built[i] = AllocateNode(m_Resource, YAMLScalar(scalar, m_Resource),
+					static_cast<YAMLNode::MultilineType>(binNode.multilineType));
+				if (poolable) scalarPool.emplace(binNode.value, built[i]);
+				continue;
+			}
+			if (binNode.type == static_cast<uint8_t>(YAMLNode::Type::NumericArray))
+			{
+				std::string_view bytes;
+				if (!getString(binNode.value, bytes) || bytes.size() != static_cast<uint64_t>(binNode.count) * sizeof(int64_t) ||
+					binNode.multilineType > static_cast<uint8_t>(YAMLNumericArray::ElementType::Double))
+					return false;
+				YAMLNumericArray array(m_Resource);
+				array.elementType = static_cast<YAMLNumericArray::ElementType>(binNode.multilineType);
+				array.precision = static_cast<int>(binNode.reserved) - 1;
+				if (array.elementType == YAMLNumericArray::ElementType::Int64)
+				{
+					array.ints.resize(binNode.count);
+					std::memcpy(array.ints.data(), bytes.data(), bytes.size());
+				}
+				else
+				{
+					array.doubles.resize(binNode.count);
+					std::memcpy(array.doubles.data(), bytes.data(), bytes.size());
+				}
+				built[i] = AllocateNode(m_Resource, std::move(array));
+				continue;
+			}
+
+			if (binNode.value > header.childCount || binNode.count > header.childCount - binNode.value) return false;
+			const BinaryChild* first = children + binNode.value;
+			// qm[ho(Lꂽm[h͕̐eQƂ邽߁AL͈ڂɋL)
+			const auto takeChild = [&](const BinaryChild& In_Child) -> std::shared_ptr<YAMLNode>
+				{
+					if (In_Child.node >= i) return nullptr;
+					return built[In_Child.node];
+				};
+
+			if (binNode.type == static_cast<uint8_t>(YAMLNode::Type::Sequence))
+			{
+				YAMLSeq seq(m_Resource);
+				seq.reserve(binNode.count);
+				for (uint32_t c = 0; c < binNode.count; ++c)
+				{
+					seq.push_back(takeChild(first[c]));
+					if (!seq.back()) return false;
+				}
+				built[i] = AllocateNode(m_Resource, std::move(seq));
+			}
+			else if (binNode.type == static_cast<uint8_t>(YAMLNode::Type::Map))
+			{
+				YAMLMap map(m_Resource);
+				map.reserve(binNode.count);
+				std::string_view key;
+				for (uint32_t c = 0; c < binNode.count; ++c)
+				{
+					if (!getString(first[c].key, key)) return false;
+					std::shared_ptr<YAMLNode> child = takeChild(first[c]);
+					if (!child) return false;
+					SetMapEntry(map, key, std::move(child));
+				}
+				built[i] = AllocateNode(m_Resource, std::move(map));
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		m_YAMLData = std::move(*built[header.nodeCount - 1]);
+		m_AnchorNames.clear();
+		m_MergeSources.clear();
+		m_SourceLayout = SourceLayout();
+		if (m_UsePathIndex) RebuildPathIndex();
+		return true;
+	}
+
+	/// <summary>
+	/// XibvVbgŐVł΂ǂݍ݁AÂ݂ȂYAMLp[XăXibvVbg蒼܂B
+	/// </summary>
+	/// <param name="In_FilePath">ǂݍYAMLt@C̃pXB</param>
+	/// <param name="In_SnapshotPath">XibvVbgt@C̃pXBȗ In_FilePath  ".bin" t́B</param>
+	/// <returns>ǂݍ݂ɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	bool ParseYAMLWithSnapshot(_In_ const std::string& In_FilePath, _In_ const std::string& In_SnapshotPath = "")
+	{
+		if (In_FilePath.empty()) return false;
+		const std::string snapshotPath = In_SnapshotPath.empty() ? In_FilePath + ".bin" : In_SnapshotPath;
+
+		if (LoadBinary(snapshotPath, In_FilePath)) return true;
+		if (!ParseYAML(In_FilePath)) return false;
+		SaveBinary(snapshotPath, In_FilePath);	// ۑɎsĂp[Xʂ͗L
+		return true;
+	}
+
+	/// <summary>
+	/// t@C̕ύXmɎgAt@C̃TCYƍXV擾܂B
+	/// </summary>
+	/// <param name="In_FilePath">Ώۃt@C̃pXB</param>
+	/// <param name="Out_Size">t@CTCY(oCg)B</param>
+	/// <param name="Out_Time">ŏIXV(t@C̃eBbNl)B</param>
+	/// <returns>擾ɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	static bool GetSourceIdentity(_In_ const std::string& In_FilePath, _Out_ uint64_t& Out_Size, _Out_ int64_t& Out_Time) noexcept
+	{
+		std::error_code ec;
+		Out_Size = std::filesystem::file_size(In_FilePath, ec);
+		if (ec) return false;
+		const auto writeTime = std::filesystem::last_write_time(In_FilePath, ec);
+		if (ec) return false;
+		Out_Time = static_cast<int64_t>(writeTime.time_since_epoch().count());
+		return true;
+	}
+
+	/// <summary>
+	/// YAMLf[^gpĂ邨悻̃ʂς܂B
+	/// </summary>
+	/// <returns>m[hAARei̊mۗʂvoCgԂ܂B</returns>
+	inline size_t EstimateMemoryUsage() const
+	{
+		std::unordered_set<const YAMLNode*> counted;
+		size_t total = sizeof(*this) + EstimateNodeMemory(m_YAMLData, counted) + EstimatePathIndexMemory(m_PathIndex);
+		for (const PathIndexLayer* layer = m_SharedPathIndex.get(); layer; layer = layer->below.get())
+			total += sizeof(PathIndexLayer) + EstimatePathIndexMemory(layer->entries);
+		return total;
+	}
+
+	/// <summary>
+	/// YAMLf[^ÂAw肳ꂽYAMLf[^VƂč\Iȍ߂܂B
+	/// ǉE폜ꂽTuc[́A̍̃pX݂̂1Ƃĕ񍐂܂B
+	/// </summary>
+	/// <param name="In_Other">rΏ(V)YAMLp[T[B</param>
+	/// <returns>̈ꗗԂ܂BȂꍇ͋łB</returns>
+	inline std::vector<YAMLChange> Diff(_In_ const YAMLParser& In_Other) const
+	{
+		// ẽnbVlقȂTuc[H邽߁A2ڈȍ~̔r͕ύX̂ɔႷ
+		return DiffNodes(m_YAMLData, In_Other.m_YAMLData);
+	}
+
+	/// <summary>
+	/// YAMLf[^Ŝ̓ẽnbVl擾܂B}bṽL[̏ɂ͈ˑ܂B
+	/// </summary>
+	/// <returns>ẽnbVlԂ܂B</returns>
+	inline uint64_t GetContentHash() const { return m_YAMLData.GetHash(); }
+
+	/// <summary>
+	/// w肳ꂽYAMLf[^ƓeǂAnbVl̔rŔ肵܂B
+	/// </summary>
+	/// <param name="In_Other">rΏۂYAMLp[T[B</param>
+	/// <returns>eꍇ trueAقȂꍇ false Ԃ܂B</returns>
+	inline bool IsSameContent(_In_ const YAMLParser& In_Other) const { return GetContentHash() == In_Other.GetContentHash(); }
+
+	/// <summary>
+	/// 2YAMLm[hԂ̍\Iȍ߂܂B
+	/// </summary>
+	/// <param name="In_Old">Ẫm[hB</param>
+	/// <param name="In_New">Ṽm[hB</param>
+	/// <returns>̈ꗗԂ܂BpX͓nꂽm[h̑΃pXłB</returns>
+	static std::vector<YAMLChange> DiffNodes(_In_ const YAMLNode& In_Old, _In_ const YAMLNode& In_New)
+	{
+		std::vector<YAMLChange> changes;
+		DiffNodes(In_Old, In_New, "", changes);
+		return changes;
+	}
+
+	/// <summary>
+	/// YAMLf[^擾܂B
+	/// </summary>
+	/// <returns>o[ϐm_YAMLData̒lԂ܂B</returns>
+	inline YAMLNode GetYAMLData() const noexcept { return m_YAMLData; }
+
+	/// <summary>
+	/// YAMLf[^𕡐ɎQƂ܂BQƂ̓p[T[ύX܂͔j܂ŗLłB
+	/// </summary>
+	inline const YAMLNode& GetRootNode() const noexcept { return m_YAMLData; }
+
+	/// <summary>
+	/// YAMLf[^m[hŒu܂Bqm[h͕ɋLAȍ~̕ύX͕ύXpX̃m[h𕡐܂B
+	/// AJ[ƕۑp̃\[Xʒu͔j܂B
+	/// </summary>
+	/// <param name="In_Root">V[gB}bvłKv܂B</param>
+	/// <returns>uꍇ trueA[g}bvłȂꍇ false Ԃ܂B</returns>
+	bool SetRootNode(_In_ YAMLNode In_Root)
+	{
+		if (In_Root.type != YAMLNode::Type::Map)
+		{
+			Log(LogLevel::Error, "[g̓}bvłKv܂B");
+			return false;
+		}
+		m_YAMLData = std::move(In_Root);
+		m_YAMLData.InvalidateHash();
+		m_SourceLayout = SourceLayout();
+		m_AnchorNames.clear();
+		m_MergeSources.clear();
+		if (m_UsePathIndex) RebuildPathIndex();
+		return true;
+	}
+
+	/// <summary>
+	/// YAMLf[^LVp[T[쐬܂Bȍ~̕ύX͕ύXpX̃m[h邽߁A
+	/// ǂύXĂɂ͉e܂B
+	/// pXCfbNXp܂B̃p[T[\zɕύXGg𕡐Ac͋L邽߁A蒼͔܂B
+	/// </summary>
+	/// <returns>̃p[T[ƃm[hLp[T[Ԃ܂B</returns>
+	inline YAMLParser Fork() const
+	{
+		YAMLParser forked(m_Resource);
+		forked.m_YAMLData = m_YAMLData;
+		forked.m_DenseArrayThreshold = m_DenseArrayThreshold;
+		forked.m_PoolScalars = m_PoolScalars;
+		forked.m_ParseLimits = m_ParseLimits;
+		forked.m_AnchorNames = m_AnchorNames;
+		forked.m_MergeSources = m_MergeSources;
+		forked.m_UsePathIndex = m_UsePathIndex;
+		if (m_UsePathIndex) forked.m_SharedPathIndex = SharePathIndex();
+		return forked;
+	}
+
+	/// <summary>
+	/// L[pXm[h𒼐ڈ߂̃pXCfbNXL܂͖܂B
+	/// LȊԂ ParseYAML ̌Ɉꊇ\zASetn֐ GenerateNode ɂύXɍ킹čXV܂B
+	/// </summary>
+	/// <param name="In_Enable">Lꍇ trueAꍇ falseB</param>
+	inline void EnablePathIndex(_In_ const bool& In_Enable = true)
+	{
+		m_UsePathIndex = In_Enable;
+		if (m_UsePathIndex) RebuildPathIndex();
+		else
+		{
+			m_PathIndex.clear();
+			m_SharedPathIndex.reset();
+		}
+	}
+
+	/// <summary>
+	/// pXCfbNXLǂ擾܂B
+	/// </summary>
+	inline bool IsPathIndexEnabled() const noexcept { return m_UsePathIndex; }
+
+	/// <summary>
+	/// ݂YAMLf[^pXCfbNXč\z܂B
+	/// </summary>
+	inline void RebuildPathIndex()
+	{
+		m_PathIndex.clear();
+		m_SharedPathIndex.reset();
+		IndexChildren("", m_YAMLData);
+	}
+
+	/// <summary>
+	/// ǂݍ񂾃eLXgƁAelĂʒu(\[XXp)ێ邩ǂݒ肵܂B ParseYAML LłB
+	/// ێĂԂ SaveChanges ŏۂۑł܂BeLXgƃpXƂ̈ʒuێ邽߁Agpʂ͑܂B
+	/// GCAX}[WL[܂ރhLǵAl̈ʒuƃm[h11ɑΉȂߕێ܂B
+	/// </summary>
+	/// <param name="In_Enable">Lꍇ trueAꍇ falseB</param>
+	inline void EnableSourceSpans(_In_ const bool& In_Enable = true)
+	{
+		m_KeepSourceSpans = In_Enable;
+		if (!In_Enable) m_SourceLayout = SourceLayout();
+	}
+
+	/// <summary>
+	/// SaveChanges ŏۂۑłԂǂ擾܂B
+	/// </summary>
+	inline bool HasSourceSpans() const noexcept { return m_SourceLayout.valid; }
+
+	/// <summary>
+	/// l̃XJ[1̃m[hŋLēǂݍނǂݒ肵܂B ParseYAML LłB
+	/// lJԂhLgł́A2ڈȍ~̒l̓m[hmۂAẽRei̗vf1̑傫ɂȂ܂B
+	/// Lm[h Fork ƓOɕ邽߁Al̕ύX̉ӏɉe邱Ƃ͂܂B
+	/// قƂǂ̒lقȂhLgł́Aǂݍݒ̏ƍ̕p[XxȂ܂B
+	/// </summary>
+	/// <param name="In_Enable">Lꍇ trueAꍇ falseB</param>
+	inline void EnableScalarPooling(_In_ const bool& In_Enable = true) noexcept { m_PoolScalars = In_Enable; }
+
+	// lzƂēǂݍރV[PX̊̍ŏvf
+	static constexpr size_t DefaultDenseArrayThreshold = 16;
+
+	/// <summary>
+	/// l̃V[PXAvfƂ̃m[h炸ɐlz(YAMLNumericArray)Ƃēǂݍލŏ̗vfݒ肵܂B
+	///  ParseYAML LłB0 w肷Əɒʏ̃V[PXƂēǂݍ݂܂B
+	/// lzL[pX("points.3")Cxgł͒ʏ̃V[PXƓ悤ɈAvfƒʏ̃V[PXɖ߂܂B
+	/// </summary>
+	/// <param name="In_MinElements">lzɂŏ̗vfB</param>
+	inline void SetDenseArrayThreshold(_In_ const size_t& In_MinElements) noexcept { m_DenseArrayThreshold = In_MinElements; }
+
+	/// <summary>
+	/// p[X̏(lXg̐[Am[hAXJ[̒A͂̑傫)ݒ肵܂B ParseYAML LłB
+	/// ꂽ͂∫ӂ̂͂ŎԂ⃁gʂȂ悤AMłȂ͂ǂޏꍇ͕Kvȑ傫ɍiĂB
+	/// </summary>
+	/// <param name="In_Limits">p[X̏B</param>
+	inline void SetParseLimits(_In_ const YAMLParseLimits& In_Limits) noexcept { m_ParseLimits = In_Limits; }
+
+	/// <summary>
+	/// p[X̒~vƐi̒ʒmݒ肵܂Bp[X͈̍sƂɒ~vm߁A~ꍇ͎sƂĈȑOYAMLf[^ێ܂B
+	/// ݒ͌ĂяoLAp[XI܂ŗLłKv܂Bnullptr ŉ܂B
+	/// </summary>
+	/// <param name="In_Control">~vƐi̒ʒmB</param>
+	inline void SetParseControl(_In_opt_ const YAMLParseControl* In_Control) noexcept { m_ParseControl = In_Control; }
+	inline const YAMLParseLimits& GetParseLimits() const noexcept { return m_ParseLimits; }
+
+	/// <summary>
+	/// w肳ꂽL[ pX̏̐lz擾܂B
+	/// </summary>
+	/// <param name="In_keyPath">lz̃L[ pXB</param>
+	/// <returns>vfQƂr[BlzłȂA܂͗vf̏ꍇ͋̃r[Ԃ܂BYAMLf[^ύX܂ŗLłB</returns>
+	inline YAMLArrayView<double> GetDoubleArray(_In_ const std::string& In_keyPath) const
+	{
+		const YAMLNumericArray* array = FindNumericArray(In_keyPath, YAMLNumericArray::ElementType::Double);
+		return array ? YAMLArrayView<double>(array->doubles.data(), array->doubles.size()) : YAMLArrayView<double>();
+	}
+
+	/// <summary>
+	/// w肳ꂽL[ pX̐̐lz擾܂B
+	/// </summary>
+	/// <param name="In_keyPath">lz̃L[ pXB</param>
+	/// <returns>vfQƂr[BlzłȂA܂͗vf̏ꍇ͋̃r[Ԃ܂BYAMLf[^ύX܂ŗLłB</returns>
+	inline YAMLArrayView<int64_t> GetInt64Array(_In_ const std::string& In_keyPath) const
+	{
+		const YAMLNumericArray* array = FindNumericArray(In_keyPath, YAMLNumericArray::ElementType::Int64);
+		return array ? YAMLArrayView<int64_t>(array->ints.data(), array->ints.size()) : YAMLArrayView<int64_t>();
+	}
+
+	/// <summary>
+	/// L[pXŕl擾
+	/// </summary>
+	/// <param name="In_keyPath">YAML̃L[̃pXihbg؂jB: "users.0.name"</param>
+	/// <param name="In_IncludeQuotes">̑OɈp܂߂邩ǂBftHgfalseB</param>
+	/// <returns>w肳ꂽL[̒l𕶎ƂĕԂ܂BL[݂Ȃꍇ͋󕶎Ԃ܂B</returns>
+	inline std::string GetString(_In_ const std::string& In_keyPath, _In_ const bool& In_IncludeQuotes = false) const
+	{
+		YAMLScalar element;
+		const YAMLScalar* val = FindScalarByPath(In_keyPath, &element);
+		if (!val) return "";
+		if (In_IncludeQuotes) return std::string(*val);
+		return std::string(UnquoteScalar(*val));
+	}
+
+	/// <summary>
+	/// L[pXŕl𕡐Ɏ擾܂B` GetString ƓłB
+	/// Ԃ̓m[h𒼐ڎQƂ邽߁Ap[T[ύX܂͔j܂ŗLłB
+	/// lz̗vf͕QƂłȂ߁Axo͂ċ̕Ԃ܂(GetString gĂ)B
+	/// </summary>
+	/// <param name="In_keyPath">YAML̃L[̃pXihbg؂jB: "users.0.name"</param>
+	/// <param name="In_IncludeQuotes">̑OɈp܂߂邩ǂBftHgfalseB</param>
+	/// <returns>w肳ꂽL[̒lԂ܂BL[݂Ȃꍇ͋̕Ԃ܂B</returns>
+	inline std::string_view GetStringView(_In_ const std::string& In_keyPath, _In_ const bool& In_IncludeQuotes = false) const
+	{
+		YAMLScalar element;
+		const YAMLScalar* val = FindScalarByPath(In_keyPath, &element);
+		if (!val) return std::string_view();
+		if (val == &element)
+		{
+			Log(LogLevel::Warning, "GetStringView: lz̗vf͕ƂĎQƂł܂: " + In_keyPath);
+			return std::string_view();
+		}
+		if (In_IncludeQuotes) return *val;
+		return UnquoteScalar(*val);
+	}
+
+	/// <summary>
+	/// L[pXbool擾
+	/// </summary>
+	/// <param name="In_keyPath">YAML̃L[̃pXihbg؂jB: "users.0.name"</param>
+	/// <returns>w肳ꂽL[̒lboolƂĕԂ܂BL[݂ȂꍇfalseԂ܂B</returns>
+	inline bool GetBool(_In_ const std::string& In_keyPath) const
+	{
+		YAMLScalar element;
+		const YAMLScalar* val = FindScalarByPath(In_keyPath, &element);
+		if (!val) return false;
+		return (*val == "true" || *val == "True" || *val == "1");
+	}
+
+	/// <summary>
+	/// L[pXint擾
+	/// </summary>
+	/// <param name="In_keyPath">YAML̃L[̃pXihbg؂jB: "users.0.age"</param>
+	/// <returns>w肳ꂽL[̒lintƂĕԂ܂BϊɎsꍇ0Ԃ܂B</returns>
+	inline int GetInt(_In_ const std::string& In_keyPath) const
+	{
+		YAMLScalar element;
+		const YAMLScalar* val = FindScalarByPath(In_keyPath, &element);
+		if (!val) return 0;
+		int value = 0;
+		auto [ptr, ec] = std::from_chars(val->data(), val->data() + val->size(), value, 10);
+		if (ec == std::errc()) return value;
+		else
+		{
+			Log(LogLevel::Warning, "ϊs: " + std::string(*val));
+			return 0;
+		}
+	}
+
+	/// <summary>
+	/// L[pXfloat擾
+	/// </summary>
+	/// <param name="In_keyPath">YAML̃L[̃pXihbg؂jB: "users.0.height"</param>
+	/// <returns>w肳ꂽL[̒lfloatƂĕԂ܂BϊɎsꍇ0.0fԂ܂B</returns>
+	inline float GetFloat(_In_ const std::string& In_keyPath) const
+	{
+		YAMLScalar element;
+		const YAMLScalar* val = FindScalarByPath(In_keyPath, &element);
+		if (!val) return 0.0f;
+		try
+		{
+			return std::stof(std::string(*val));
+		}
+		catch (const std::invalid_argument& e)
+		{
+			Log(LogLevel::Warning, std::string("_ϊs: ") + e.what());
+		}
+		catch (const std::out_of_range& e)
+		{
+			Log(LogLevel::Warning, std::string("_͈͊O: ") + e.what());
+		}
+		return 0.0f;
+	}
+
+	/// <summary>
+	/// L[pXdouble擾
+	/// </summary>
+	/// <param name="In_keyPath">YAML̃L[̃pXihbg؂jB: "users.0.weight"</param>
+	/// <returns>w肳ꂽL[̒ldoubleƂĕԂ܂BϊɎsꍇ0.0Ԃ܂B</returns>
+	inline double GetDouble(_In_ const std::string& In_keyPath) const
+	{
+		YAMLScalar element;
+		const YAMLScalar* val = FindScalarByPath(In_keyPath, &element);
+		if (!val) return 0.0;
+		try
+		{
+			return std::stod(std::string(*val));
+		}
+		catch (const std::invalid_argument& e)
+		{
+			Log(LogLevel::Warning, std::string("_ϊs: ") + e.what());
+		}
+		catch (const std::out_of_range& e)
+		{
+			Log(LogLevel::Warning, std::string("_͈͊O: ") + e.what());
+		}
+		return 0.0;
+	}
+
+	/// <summary>
+	/// w肳ꂽL[ pX݂邩ǂ𔻒肵܂B
+	/// </summary>
+	/// <param name="In_keyPath">L[ pX\B</param>
+	/// <returns>L[ pX݂ꍇ trueA݂Ȃꍇ false Ԃ܂B</returns>
+	inline bool HasKey(_In_ const std::string& In_keyPath) const
+	{
+		if (In_keyPath.empty()) return false;
+		if (FindIndexedNode(In_keyPath)) return true;
+		const YAMLNode* node = &m_YAMLData;
+		size_t pos = 0, next;
+		while (pos < In_keyPath.size())
+		{
+			next = In_keyPath.find('.', pos);
+			const YAMLString token(std::string_view(In_keyPath).substr(pos, next == std::string::npos ? std::string::npos : next - pos));
+			if (node->type == YAMLNode::Type::Map)
+			{
+				const auto& map = std::get<YAMLMap>(node->value);
+				auto itr = map.find(token);
+				if (itr == map.end()) return false;
+				node = itr->second.get();
+			}
+			else if (node->type == YAMLNode::Type::Sequence)
+			{
+				if (!std::all_of(token.begin(), token.end(), ::isdigit)) return false;
+				const size_t idx = ToIndex(token);
+				const auto& seq = std::get<YAMLSeq>(node->value);
+				if (idx >= seq.size()) return false;
+				node = seq[idx].get();
+			}
+			else if (node->type == YAMLNode::Type::NumericArray)
+			{
+				// lz̗vf͎qȂ߁AŌ̃g[NłȂ΂ȂȂ
+				if (next != std::string::npos || !std::all_of(token.begin(), token.end(), ::isdigit)) return false;
+				return ToIndex(token) < std::get<YAMLNumericArray>(node->value).size();
+			}
+			else if (node->type == YAMLNode::Type::Scalar)
+			{
+				// XJ[l̏ꍇAL[ pX̍Ō̕łȂƂmF
+				if (token.empty()) return true;
+				return false;
+			}
+			else
+			{
+				return false;
+			}
+			if (next == std::string::npos) break;
+			pos = next + 1;
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// w肳ꂽL[̃pXɏ]YAMLm[hAm[h̋L|C^Ԃ܂B
+	/// </summary>
+	/// <param name="In_keyPath">hbg؂̕ŕ\ꂽYAMLm[hւ̃pXB: "root.child.key"</param>
+	/// <returns>pXŎw肳ꂽYAMLm[hstd::shared_ptrBm[hȂꍇnullptrԂ܂B</returns>
+	inline std::shared_ptr<YAMLNode> GetNodeByPath(_In_ const std::string& In_keyPath) const
+	{
+		if (const YAMLNode* indexed = FindIndexedNode(In_keyPath))
+			return std::make_shared<YAMLNode>(*indexed);
+
+		const YAMLNode* node = &m_YAMLData;
+		size_t pos = 0, next;
+		while (pos < In_keyPath.size())
+		{
+			next = In_keyPath.find('.', pos);
+			const YAMLString token(std::string_view(In_keyPath).substr(pos, next == std::string::npos ? std::string::npos : next - pos));
+			if (node->type == YAMLNode::Type::Map)
+			{
+				const auto& map = std::get<YAMLMap>(node->value);
+				auto itr = map.find(token);
+				if (itr == map.end()) return nullptr;
+				node = itr->second.get();
+			}
+			else if (node->type == YAMLNode::Type::Sequence)
+			{
+				if (!std::all_of(token.begin(), token.end(), ::isdigit)) return nullptr;
+				const size_t idx = ToIndex(token);
+				const auto& seq = std::get<YAMLSeq>(node->value);
+				if (idx >= seq.size()) return nullptr;
+				node = seq[idx].get();
+			}
+			else if (node->type == YAMLNode::Type::NumericArray)
+			{
+				// lz̗vf̓XJ[m[hƂĕԂ
+				if (next != std::string::npos || !std::all_of(token.begin(), token.end(), ::isdigit)) return nullptr;
+				const auto& array = std::get<YAMLNumericArray>(node->value);
+				const size_t idx = ToIndex(token);
+				if (idx >= array.size()) return nullptr;
+				char buffer[YAMLNumericArray::FormatBufferSize];
+				return std::make_shared<YAMLNode>(YAMLScalar(array.Format(idx, buffer)));
+			}
+			else
+			{
+				return nullptr; // }bvV[PXł͂Ȃꍇ
+			}
+			if (next == std::string::npos) break;
+			pos = next + 1;
+		}
+		return std::make_shared<YAMLNode>(*node);
+	}
+
+	/// <summary>
+	/// w肳ꂽL[̃pXɏ]YAMLf[^̃XJ[lݒ肵܂B
+	/// </summary>
+	/// <param name="In_keyPath">ݒΏۂ̒l̃pXihbg؂̕jB</param>
+	/// <param name="In_Value">ݒ肷镶lB</param>
+	/// <returns>l̐ݒɐꍇtrueAsꍇfalseԂ܂B</returns>
+	bool SetString(_In_ const std::string& In_keyPath, _In_ const std::string& In_Value)
+	{
+		if (In_keyPath.empty()) return false;
+		if (!HasKey(In_keyPath)) // L[pX݂Ȃꍇ͐VKɐ
+			GenerateNode(In_keyPath, YAMLNode::Type::Scalar);
+
+		// LĂm[h͏Oɕ邽߁A݂͏Ƀ[gH
+		YAMLNode* node = &m_YAMLData;
+		node->InvalidateHash();
+		std::string indexPath;
+		bool indexable = m_UsePathIndex;
+		size_t pos = 0, next;
+		while (pos < In_keyPath.size())
+		{
+			next = In_keyPath.find('.', pos);
+			const YAMLString token(std::string_view(In_keyPath).substr(pos, next == std::string::npos ? std::string::npos : next - pos));
+			try
+			{
+				if (node->type == YAMLNode::Type::NumericArray) ExpandNumericArray(*node, indexPath, indexable);
+				if (node->type == YAMLNode::Type::Map)
+				{
+					auto& map = std::get<YAMLMap>(node->value);
+					indexable = indexable && IsIndexableKey(token);
+					if (indexable) indexPath = JoinPath(indexPath, token);
+					auto itr = map.find(token);
+					if (itr == map.end())
+					{
+						map[token] = AllocateNode(m_Resource, YAMLScalar(m_Resource));
+						itr = map.find(token);
+					}
+					node = DetachShared(itr->second, indexPath, indexable);
+				}
+				else if (node->type == YAMLNode::Type::Sequence)
+				{
+					if (!std::all_of(token.begin(), token.end(), ::isdigit))
+					{
+						Log(LogLevel::Error, "SetString: V[PXm[hɐlȊÕCfbNXw肪܂: " + std::string(token));
+						return false;
+					}
+					const size_t idx = ToIndex(token);
+					auto& seq = std::get<YAMLSeq>(node->value);
+					if (idx >= seq.size())
+					{
+						Log(LogLevel::Error, "SetString: V[PXCfbNX͈͊Oł: " + std::to_string(idx));
+						return false;
+					}
+					if (indexable) indexPath = JoinPath(indexPath, std::to_string(idx));
+					node = DetachShared(seq[idx], indexPath, indexable);
+				}
+				else
+				{
+					Log(LogLevel::Error, "SetString: m[h^MapłSequenceł܂B");
+					return false;
+				}
+			}
+			catch (const std::bad_variant_access& e)
+			{
+				Log(LogLevel::Error, std::string("SetString: m[h^valuevariant^v܂: ") + e.what());
+				return false;
+			}
+			catch (const std::exception& e)
+			{
+				Log(LogLevel::Error, std::string("SetString: O: ") + e.what());
+				return false;
+			}
+			if (next == std::string::npos) break;
+			pos = next + 1;
+		}
+		if (node->type != YAMLNode::Type::Scalar)
+		{
+			Log(LogLevel::Error, "SetString: ŏIm[h^Scalarł͂܂B");
+			return false;
+		}
+		try
+		{
+			std::get<YAMLScalar>(node->value).assign(In_Value.data(), In_Value.size()); // lݒ
+		}
+		catch (const std::bad_variant_access& e)
+		{
+			Log(LogLevel::Error, std::string("SetString: lݒ莞variant^sv: ") + e.what());
+			return false;
+		}
+		catch (const std::exception& e)
+		{
+			Log(LogLevel::Error, std::string("SetString: lݒ莞ɗO: ") + e.what());
+			return false;
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// w肳ꂽL[ɐlݒ肵܂B
+	/// </summary>
+	/// <param name="In_keyPath">lݒ肷L[̃pXB</param>
+	/// <param name="In_Value">ݒ肷鐮lB</param>
+	/// <returns>l̐ݒ肪ꍇ trueAsꍇ false Ԃ܂B</returns>
+	/// <summary>
+	/// w肳ꂽL[ɐlݒ肵܂B
+	/// </summary>
+	/// <param name="In_keyPath">lݒ肷L[̃pXB</param>
+	/// <param name="In_Value">ݒ肷鐮lB</param>
+	/// <returns>l̐ݒ肪ꍇ trueAsꍇ false Ԃ܂B</returns>
+	inline bool SetInt(_In_ const std::string& In_keyPath, _In_ const int& In_Value)
+	{
+		return SetString(In_keyPath, std::to_string(In_Value));
+	}
+
+	/// <summary>
+	/// w肳ꂽL[ɑ΂Đ^Ulݒ肵܂B
+	/// </summary>
+	/// <param name="In_keyPath">lݒ肷Ώۂ̃L[̃pXB</param>
+	/// <param name="In_Value">ݒ肷^UlBtrue ܂ falseB</param>
+	/// <returns>l̐ݒ肪ꍇ trueAsꍇ false Ԃ܂B</returns>
+	inline bool SetBool(_In_ const std::string& In_keyPath, _In_ const bool& In_Value)
+	{
+		return SetString(In_keyPath, In_Value ? "true" : "false");
+	}
+
+	/// <summary>
+	/// w肳ꂽL[ɑΉlƂāAfloat^̒l𕶎ƂĐݒ肵܂B
+	/// </summary>
+	/// <param name="In_keyPath">lݒ肷Ώۂ̃L[̃pXB</param>
+	/// <param name="In_Value">ݒ肷float^̒lB</param>
+	/// <returns>l̐ݒ肪ꍇtrueAsꍇfalseԂ܂B</returns>
+	inline bool SetFloat(_In_ const std::string& In_keyPath, _In_ const float& In_Value)
+	{
+		return SetString(In_keyPath, std::to_string(In_Value));
+	}
+
+	/// <summary>
+	/// w肳ꂽL[ɑΉlƂ double ^̒lݒ肵܂B
+	/// </summary>
+	/// <param name="In_keyPath">lݒ肷Ώۂ̃L[̃pXB</param>
+	/// <param name="In_Value">ݒ肷 double ^̒lB</param>
+	/// <returns>l̐ݒ肪ꍇ trueAsꍇ false Ԃ܂B</returns>
+	inline bool SetDouble(_In_ const std::string& In_keyPath, _In_ const double& In_Value)
+	{
 		return SetString(In_keyPath, std::to_string(In_Value));
 	}
 
-	/// <summary>
-	/// w肳ꂽL[ɑΉlƂ double ^̒lݒ肵܂B
-	/// </summary>
-	/// <param name="In_keyPath">lݒ肷Ώۂ̃L[̃pXB</param>
-	/// <param name="In_Value">ݒ肷 double ^̒lB</param>
-	/// <returns>l̐ݒ肪ꍇ trueAsꍇ false Ԃ܂B</returns>
-	inline bool SetDouble(_In_ const std::string& In_keyPath, _In_ const double& In_Value)
+	/// <summary>
+	/// w肳ꂽpXɏ]YAMLm[hA̒lݒ肵܂B
+	/// </summary>
+	/// <param name="In_keyPath">m[h邽߂̃hbg؂̃L[B</param>
+	/// <param name="In_Node">ݒ肷lYAMLm[hւ̋L|C^B</param>
+	/// <returns>l̐ݒ肪ꍇtrueAsꍇfalseԂ܂B</returns>
+	bool SetNodeByPath(_In_ const std::string& In_keyPath, _In_ const std::shared_ptr<YAMLNode>& In_Node)
+	{
+		YAMLNode* node = &m_YAMLData;
+		node->InvalidateHash();
+		std::string indexPath;
+		bool indexable = m_UsePathIndex;
+		size_t pos = 0, next;
+		while (pos < In_keyPath.size())
+		{
+			next = In_keyPath.find('.', pos);
+			const YAMLString token(std::string_view(In_keyPath).substr(pos, next == std::string::npos ? std::string::npos : next - pos));
+			if (node->type == YAMLNode::Type::NumericArray) ExpandNumericArray(*node, indexPath, indexable);
+			if (node->type == YAMLNode::Type::Map)
+			{
+				auto& map = std::get<YAMLMap>(node->value);
+				indexable = indexable && IsIndexableKey(token);
+				if (indexable) indexPath = JoinPath(indexPath, token);
+				auto itr = map.find(token);
+				if (itr == map.end())
+				{
+					map[token] = AllocateNode(m_Resource, YAMLScalar(m_Resource));
+					itr = map.find(token);
+				}
+				node = DetachShared(itr->second, indexPath, indexable);
+			}
+			else if (node->type == YAMLNode::Type::Sequence)
+			{
+				if (!std::all_of(token.begin(), token.end(), ::isdigit)) return false;
+				const size_t idx = ToIndex(token);
+				auto& seq = std::get<YAMLSeq>(node->value);
+				if (idx >= seq.size())
+				{
+					return false; // CfbNX͈͊O
+				}
+				if (indexable) indexPath = JoinPath(indexPath, std::to_string(idx));
+				node = DetachShared(seq[idx], indexPath, indexable);
+			}
+			else
+			{
+				return false; // }bvV[PXł͂Ȃꍇ
+			}
+			if (next == std::string::npos) break;
+			pos = next + 1;
+		}
+		if (node->type != YAMLNode::Type::Map && node->type != YAMLNode::Type::Sequence) return false; // ŏIm[h}bvV[PXłȂꍇ
+		if (indexable) UnindexChildren(indexPath, *node);
+		node->value = In_Node->value; // lݒ
+		node->type = In_Node->type;
+		node->multilineType = In_Node->multilineType;
+		if (indexable) IndexChildren(indexPath, *node);
+		return true;
+	}
+
+	/// <summary>
+	/// w肳ꂽL[̃pXɏ]YAMLm[h𐶐Am[ȟ^ƕs^Cvݒ肵܂B
+	/// </summary>
+	/// <param name="In_keyPath">m[h𐶐邽߂̃hbg؂̃L[̃pXB</param>
+	/// <param name="In_Type">m[ȟ^B</param>
+	/// <param name="In_MultilineType">m[h̕s^CvBȗNoneB</param>
+	void GenerateNode(_In_ const std::string& In_keyPath, _In_ const YAMLNode::Type& In_Type,
+		_In_ const YAMLNode::MultilineType& In_MultilineType = YAMLNode::MultilineType::None)
+	{
+		YAMLNode* node = &m_YAMLData;
+		node->InvalidateHash();
+		// pXCfbNXXVp̐Kς݃pX(V[PXY "01" -> "1" ̂悤ɐK)
+		std::string indexPath;
+		bool indexable = m_UsePathIndex;
+		size_t pos = 0, next;
+		while (pos < In_keyPath.size())
+		{
+			next = In_keyPath.find('.', pos);
+			const YAMLString token(std::string_view(In_keyPath).substr(pos, next == std::string::npos ? std::string::npos : next - pos));
+
+			try
+			{
+				// lz͗vf̃m[hȂ߁Aʏ̃V[PXɓWJĂH
+				if (node->type == YAMLNode::Type::NumericArray) ExpandNumericArray(*node, indexPath, indexable);
+				// }bv̏ꍇ
+				if (node->type == YAMLNode::Type::Map)
+				{
+					auto& map = std::get<YAMLMap>(node->value);
+					indexable = indexable && IsIndexableKey(token);
+					if (indexable) indexPath = JoinPath(indexPath, token);
+					auto itr = map.find(token);
+					if (itr == map.end())
+					{
+						// Ō̃g[NȂw肳ꂽ^Ő
+						if (next == std::string::npos)
+						{
+							switch (In_Type)
+							{
+							case YAMLNode::Type::Scalar:
+								map[token] = AllocateNode(m_Resource, YAMLScalar(m_Resource), In_MultilineType);
+								break;
+							case YAMLNode::Type::Map:
+								map[token] = AllocateNode(m_Resource, YAMLMap(m_Resource));
+								break;
+							case YAMLNode::Type::Sequence:
+								map[token] = AllocateNode(m_Resource, YAMLSeq(m_Resource));
+								break;
+							case YAMLNode::Type::NumericArray:
+								map[token] = AllocateNode(m_Resource, YAMLNumericArray(m_Resource));
+								break;
+							}
+						}
+						else
+						{
+							// rm[h͕KMapŐ
+							map[token] = AllocateNode(m_Resource, YAMLMap(m_Resource));
+						}
+						itr = map.find(token);
+						if (indexable) IndexNode(indexPath, itr->second.get());
+					}
+					node = DetachShared(itr->second, indexPath, indexable);
+				}
+				// V[PX̏ꍇ
+				else if (node->type == YAMLNode::Type::Sequence)
+				{
+					if (!std::all_of(token.begin(), token.end(), ::isdigit))
+						throw std::invalid_argument("YAML: V[PXm[hɐlȊÕCfbNXw肪܂: " + std::string(token));
+					const size_t idx = ToIndex(token);
+					auto& seq = std::get<YAMLSeq>(node->value);
+					// ȂꍇMapŖ߂
+					while (seq.size() <= idx)
+					{
+						seq.push_back(AllocateNode(m_Resource, YAMLMap(m_Resource)));
+						if (indexable) IndexNode(JoinPath(indexPath, std::to_string(seq.size() - 1)), seq.back().get());
+					}
+					if (indexable) indexPath = JoinPath(indexPath, std::to_string(idx));
+					node = DetachShared(seq[idx], indexPath, indexable);
+				}
+				else if (node->type == YAMLNode::Type::Scalar)
+				{
+					// rm[hXJ[̏ꍇ͕s
+					if (next != std::string::npos)
+						throw std::logic_error("YAML: XJ[m[h̉Ɏqm[h𐶐邱Ƃ͂ł܂: " + std::string(token));
+
+					node->type = In_Type;
+					node->multilineType = In_MultilineType;
+					ResetNodeValue(*node, In_Type);
+					return;
+				}
+				else
+				{
+					throw std::logic_error("YAML: m̃m[h^ł");
+				}
+			}
+			catch (const std::bad_variant_access& e)
+			{
+				Log(LogLevel::Error, std::string("YAML: m[h^valuevariant^v܂: ") + e.what());
+				return;
+			}
+			catch (const std::exception& e)
+			{
+				Log(LogLevel::Error, std::string("YAML: O: ") + e.what());
+				return;
+			}
+			catch (...)
+			{
+				Log(LogLevel::Error, "YAML: sȗO܂B");
+				return;
+			}
+
+			if (next == std::string::npos) break;
+			// ̃g[N֐i
+			pos = next + 1;
+		}
+		// ŏIm[ȟ^ƃ}`C^Cvݒ(^ςꍇ͒ľ^̋̒lɂ)
+		if (node->type != In_Type)
+		{
+			if (indexable) UnindexChildren(indexPath, *node);
+			ResetNodeValue(*node, In_Type);
+		}
+		node->type = In_Type;
+		node->multilineType = In_MultilineType;
+	}
+
+	/// <summary>
+	/// YAMLm[h̓eCfgtŕWo͂ɕ\܂B
+	/// </summary>
+	/// <param name="In_IndentDepth">õ͎CfgiXy[XjBftHg0łB</param>
+	inline void Print_YAML(_In_ const int& In_IndentDepth = 0) const noexcept
+	{
+		const std::string strIndent(In_IndentDepth, ' ');
+
+		switch (m_YAMLData.type)
+		{
+		case YAMLNode::Type::Scalar:
+			std::cout << strIndent << std::get<YAMLScalar>(m_YAMLData.value) << "\n";
+			break;
+		case YAMLNode::Type::Sequence:
+			for (const auto& seqNode : std::get<YAMLSeq>(m_YAMLData.value))
+			{
+				switch (seqNode->type)
+				{
+				case YAMLNode::Type::Scalar:
+					std::cout << strIndent << "- ";
+					Print_YAML(seqNode, 0);
+					break;
+				case YAMLNode::Type::Sequence:
+				case YAMLNode::Type::NumericArray:
+					std::cout << strIndent << "- \n";
+					Print_YAML(seqNode, In_IndentDepth + 2);
+					break;
+				case YAMLNode::Type::Map:
+					std::cout << strIndent << "- \n";
+					for (const auto& kv : std::get<YAMLMap>(seqNode->value))
+					{
+						std::cout << strIndent << "  " << kv.first << ":";
+						if (kv.second->type == YAMLNode::Type::Scalar)
+						{
+							std::cout << " " << std::get<YAMLScalar>(kv.second->value) << "\n";
+						}
+						else
+						{
+							std::cout << "\n";
+							Print_YAML(kv.second, In_IndentDepth + 4);
+						}
+					}
+					break;
+				default:
+					break;
+				}
+			}
+			break;
+		case YAMLNode::Type::Map:
+			for (const auto& keyValue : std::get<YAMLMap>(m_YAMLData.value))
+			{
+				std::cout << strIndent << keyValue.first << ":";
+				if (keyValue.second->type == YAMLNode::Type::Scalar)
+				{
+					std::cout << " " << std::get<YAMLScalar>(keyValue.second->value) << "\n";
+				}
+				else
+				{
+					std::cout << "\n";
+					Print_YAML(keyValue.second, In_IndentDepth + 2);
+				}
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+private:
+
+	// m[h̊mۂɎg\[X
+	std::pmr::memory_resource* m_Resource;
+	// YAMLf[^ێ郁o[ϐ
+	YAMLNode m_YAMLData;
+
+#if defined(YAMLPARSER_ENABLE_STATS)
+	// ߂̃p[X̓v
+	YAMLStats m_Stats;
+#endif
+
+	// ߂̃p[XŌ
+	std::vector<YAMLDiagnostic> m_Diagnostics;
+
+	// ̗vfȏ̐l̃V[PX𐔒lzƂēǂݍ(0 ̏ꍇ͏ɒʏ̃V[PX)
+	size_t m_DenseArrayThreshold = DefaultDenseArrayThreshold;
+	// l̃XJ[̃m[hLēǂݍނǂ
+	bool m_PoolScalars = false;
+	// p[X̏
+	YAMLParseLimits m_ParseLimits;
+	// p[X̒~vƐi̒ʒm(ĂяoL)
+	const YAMLParseControl* m_ParseControl = nullptr;
+
+	// ǂݍݎɃAJ[tĂm[hƂ̖OBSaveYAML ŃAJ[ƃGCAXo߂̎肪ŁA
+	// oɃm[h̋Lm߂邽߁AύXŊOꂽm[hcĂĂo͂͐
+	using AnchorNameTable = std::unordered_map<const YAMLNode*, std::string>;
+	// }[WL[ŗvf荞񂾃}bv([g nullptr)ƁA̎荞݌
+	using MergeSourceTable = std::unordered_map<const YAMLNode*, std::vector<std::weak_ptr<YAMLNode>>>;
+	// EmitDocumentEvents Œʒmς݂̃AJ[ƁA̖OݎwĂm[h
+	using AnchorBindings = std::unordered_map<std::string_view, const YAMLNode*>;
+	AnchorNameTable m_AnchorNames;
+	MergeSourceTable m_MergeSources;
+
+	// \[XXp̒l̈ʒuBinText  false ̒l(sXJ[Ȃ) SourceLayout::detached Ɏʂ
+	struct SourceSpan
+	{
+		size_t offset;
+		size_t size;
+		bool inText;
+	};
+	// ǂݍ񂾂Ƃ̃Reǐ^Ǝqvf̐
+	struct SourceContainer
+	{
+		YAMLNode::Type type;
+		size_t count;
+	};
+	// EnableSourceSpans ŕێǂݍݎ̃eLXgƁApX(JoinPath ̌`A[g͋󕶎)Ƃ̒l̈ʒu
+	struct SourceLayout
+	{
+		bool valid = false;
+		std::string text;									// p[XeLXg(Shift_JIS)
+		std::string detached;								// eLXgɌȂl̎ʂ
+		std::unordered_map<std::string, SourceSpan> scalars;
+		std::unordered_map<std::string, SourceContainer> containers;
+		bool asciiOnly = false;								// eLXgƃt@C̃oCgʒuv邩
+		std::string filePath;								// ǂݍ񂾃t@C(obt@ǂݍ񂾏ꍇ͋)
+		uint64_t fileSize = 0;								// Ōɓǂݏ_̃t@CTCY
+		int64_t fileTime = 0;								// Ōɓǂݏ_̍XV
+	};
+	// l1̍ւ
+	struct SourceEdit
+	{
+		size_t offset;		// SourceLayout::text ̈ʒu
+		size_t size;		// ւ錳̕\L̒
+		std::string text;	// V\L
+	};
+	bool m_KeepSourceSpans = false;
+	SourceLayout m_SourceLayout;
+
+	// pXCfbNXgp邩ǂ
+	bool m_UsePathIndex = false;
+	// hbg؂̃tpXm[hւ̃CfbNX([g͊܂܂Ȃ)
+	using PathIndexMap = std::unordered_map<std::string, YAMLNode*>;
+	/// <summary>
+	/// Fork p[T[mŋLAύXȂpXCfbNX̑włB
+	/// ̑w̃Gg̑wD悳Al nullptr ̃Gg͉̑w̃Gg폜ς݂ƂĉB܂B
+	/// </summary>
+	struct PathIndexLayer
+	{
+		PathIndexMap entries;
+		std::shared_ptr<const PathIndexLayer> below;
+	};
+	// ̃p[T[ǉEύXE폜(nullptr)GgBm_SharedPathIndex D悳
+	PathIndexMap m_PathIndex;
+	// Fork pGg
+	std::shared_ptr<const PathIndexLayer> m_SharedPathIndex;
+
+	/// <summary>
+	/// YAMLm[hWo͂ɃCfgtōċAIɕ\܂B
+	/// </summary>
+	/// <param name="In_Node">\YAMLm[hւ̋L|C^B</param>
+	/// <param name="In_IndentDepth">݂̃CfgiXy[XjBftHg0B</param>
+	static void Print_YAML(_In_ const std::shared_ptr<YAMLNode>& In_Node, _In_ const int& In_IndentDepth = 0)
+	{
+		if (!In_Node) return;
+		const std::string strIndent(In_IndentDepth, ' ');
+
+		switch (In_Node->type)
+		{
+		case YAMLNode::Type::Scalar:
+			std::cout << strIndent << std::get<YAMLScalar>(In_Node->value) << "\n";
+			break;
+		case YAMLNode::Type::NumericArray:
+		{
+			const auto& array = std::get<YAMLNumericArray>(In_Node->value);
+			char buffer[YAMLNumericArray::FormatBufferSize];
+			for (size_t i = 0; i < array.size(); ++i)
+				std::cout << strIndent << "- " << array.Format(i, buffer) << "\n";
+			break;
+		}
+		case YAMLNode::Type::Sequence:
+			for (const auto& seqNode : std::get<YAMLSeq>(In_Node->value))
+			{
+				switch (seqNode->type)
+				{
+				case YAMLNode::Type::Scalar:
+					std::cout << strIndent << "- ";
+					Print_YAML(seqNode, 0);
+					break;
+				case YAMLNode::Type::Sequence:
+				case YAMLNode::Type::NumericArray:
+					std::cout << strIndent << "- \n";
+					Print_YAML(seqNode, In_IndentDepth + 2);
+					break;
+				case YAMLNode::Type::Map:
+					std::cout << strIndent << "- \n";
+					for (const auto& kv : std::get<YAMLMap>(seqNode->value))
+					{
+						std::cout << strIndent << "  " << kv.first << ":";
+						if (kv.second->type == YAMLNode::Type::Scalar)
+						{
+							std::cout << " " << std::get<YAMLScalar>(kv.second->value) << "\n";
+						}
+						else
+						{
+							std::cout << "\n";
+							Print_YAML(kv.second, In_IndentDepth + 4);
+						}
+					}
+					break;
+				default:
+					break;
+				}
+			}
+			break;
+		case YAMLNode::Type::Map:
+			for (const auto& keyValue : std::get<YAMLMap>(In_Node->value))
+			{
+				std::cout << strIndent << keyValue.first << ":";
+				if (keyValue.second->type == YAMLNode::Type::Scalar)
+				{
+					std::cout << " " << std::get<YAMLScalar>(keyValue.second->value) << "\n";
+				}
+				else
+				{
+					std::cout << "\n";
+					Print_YAML(keyValue.second, In_IndentDepth + 2);
+				}
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	/// <summary>
+	/// AJ[tm[hAŏɌꂽӏł OnAnchor tāA2ڈȍ~ OnAlias ƂĒʒm܂B
+	/// Oʂ̃m[hɕtꂽ́Ãm[hɂxAJ[tĒʒm܂B
+	/// </summary>
+	template <class Handler>
+	void EmitShared(_In_ const YAMLNode& In_Node, _Inout_ Handler& In_Handler, _Inout_ AnchorBindings& In_Bindings) const
+	{
+		const auto anchor = m_AnchorNames.find(&In_Node);
+		if (anchor != m_AnchorNames.end())
+		{
+			const YAMLNode*& bound = In_Bindings[anchor->second];
+			if (bound == &In_Node)
+			{
+				In_Handler.OnAlias(anchor->second);
+				return;
+			}
+			bound = &In_Node;
+			In_Handler.OnAnchor(anchor->second);
+		}
+		EmitAnchoredContent(In_Node, In_Handler, In_Bindings);
+	}
+
+	template <class Handler>
+	void EmitAnchoredContent(_In_ const YAMLNode& In_Node, _Inout_ Handler& In_Handler, _Inout_ AnchorBindings& In_Bindings) const
+	{
+		if (In_Node.type == YAMLNode::Type::Sequence)
+		{
+			In_Handler.OnSeqStart();
+			for (const auto& child : std::get<YAMLSeq>(In_Node.value))
+				EmitShared(*child, In_Handler, In_Bindings);
+			In_Handler.OnSeqEnd();
+			return;
+		}
+		if (In_Node.type != YAMLNode::Type::Map)
+		{
+			EmitEvents(In_Node, In_Handler);
+			return;
+		}
+
+		const auto& map = std::get<YAMLMap>(In_Node.value);
+		std::vector<std::pair<std::string_view, const YAMLMap*>> sources;
+		const bool merged = FindMergeSources(In_Node, In_Bindings, sources);
+		In_Handler.OnMapStart();
+		if (merged)
+		{
+			In_Handler.OnKey("<<");
+			if (sources.size() > 1) In_Handler.OnSeqStart();
+			for (const auto& source : sources)
+				In_Handler.OnAlias(source.first);
+			if (sources.size() > 1) In_Handler.OnSeqEnd();
+		}
+		// AJ[lɒʒmA}bv̌㑱̗vfGCAX}[WL[ŎQƂł悤ɂ
+		for (const bool anchoredPass : { true, false })
+		{
+			for (const auto& keyValue : map)
+			{
+				if ((m_AnchorNames.count(keyValue.second.get()) != 0) != anchoredPass) continue;
+				if (merged && IsMergedValue(keyValue, sources)) continue;
+				In_Handler.OnKey(keyValue.first);
+				EmitShared(*keyValue.second, In_Handler, In_Bindings);
+			}
+		}
+		In_Handler.OnMapEnd();
+	}
+
+	/// <summary>
+	/// }[WL[ŗvf荞񂾃}bvɂāA荞݌̃}bvƂ̃AJ[擾܂B
+	/// 荞݌ׂĒʒmς݂ŁA̗vf̃L[ׂă}bvɎcĂꍇɌ true Ԃ܂B
+	/// </summary>
+	bool FindMergeSources(_In_ const YAMLNode& In_Node, _In_ const AnchorBindings& In_Bindings,
+		_Out_ std::vector<std::pair<std::string_view, const YAMLMap*>>& Out_Sources) const
+	{
+		const auto merge = m_MergeSources.find(&In_Node == &m_YAMLData ? nullptr : &In_Node);
+		if (merge == m_MergeSources.end()) return false;
+		const auto& map = std::get<YAMLMap>(In_Node.value);
+		for (const auto& weakSource : merge->second)
+		{
+			const std::shared_ptr<YAMLNode> source = weakSource.lock();
+			if (!source || source->type != YAMLNode::Type::Map) return false;
+			const auto anchor = m_AnchorNames.find(source.get());
+			if (anchor == m_AnchorNames.end()) return false;
+			const auto bound = In_Bindings.find(anchor->second);
+			if (bound == In_Bindings.end() || bound->second != source.get()) return false;
+
+			// ʒmς݂̃m[h̓hLgɂ邽߁AbNOĂQƂ͗L
+			const auto& sourceMap = std::get<YAMLMap>(source->value);
+			for (const auto& keyValue : sourceMap)
+				if (map.find(keyValue.first) == map.end()) return false;
+			Out_Sources.emplace_back(anchor->second, &sourceMap);
+		}
+		return !Out_Sources.empty();
+	}
+
+	// vf}[WL[Ŏ荞񂾒l̂܂܂(L[ŏ̎荞݌Ɠm[h)
+	static bool IsMergedValue(_In_ const YAMLMap::value_type& In_KeyValue, _In_ const std::vector<std::pair<std::string_view, const YAMLMap*>>& In_Sources)
+	{
+		for (const auto& source : In_Sources)
+		{
+			const auto itr = source.second->find(In_KeyValue.first);
+			if (itr != source.second->end()) return itr->second == In_KeyValue.second;
+		}
+		return false;
+	}
+
+	static inline void WriteScalar(std::ostream& Out_OStream, _In_ std::string_view In_Scalar,
+		_In_ const YAMLNode::MultilineType& In_MultilineType, _In_ const int& In_IndentDepth)
+	{
+		if (In_MultilineType == YAMLNode::MultilineType::Literal)
+		{
+			Out_OStream << " |\n";
+			WriteLines(Out_OStream, In_Scalar, In_IndentDepth);
+		}
+		else if (In_MultilineType == YAMLNode::MultilineType::Folded)
+		{
+			Out_OStream << " >\n";
+			WriteLines(Out_OStream, In_Scalar, In_IndentDepth);
+		}
+		else if (NeedsQuotes(In_Scalar) && !IsQuotedScalar(In_Scalar))
+		{
+			// ǂݖ߂Ƃɕʂ̍\Ƃĉ߂Ȃ悤pň͂(dp܂ޒl͈dpň͂)
+			const char quote = (In_Scalar.find('"') != std::string_view::npos && In_Scalar.find('\'') == std::string_view::npos) ? '\'' : '"';
+			Out_OStream << " " << quote << In_Scalar << quote << "\n";
+		}
+		else
+		{
+			Out_OStream << " " << In_Scalar << "\n";
+		}
+	}
+
+	// Oオ΂ɂȂpň͂܂ꂽ\L̃XJ[
+	static inline bool IsQuotedScalar(_In_ std::string_view In_Scalar) noexcept
+	{
+		return In_Scalar.size() >= 2 && (In_Scalar.front() == '"' || In_Scalar.front() == '\'') && In_Scalar.back() == In_Scalar.front();
+	}
+
+	// sŋ؂ꂽesCfgtŏo܂B̉šɋs͏o͂܂B
+	static inline void WriteLines(std::ostream& Out_OStream, _In_ std::string_view In_Text, _In_ const int& In_IndentDepth)
+	{
+		size_t pos = 0;
+		while (pos < In_Text.size())
+		{
+			const size_t end = (std::min)(In_Text.find('\n', pos), In_Text.size());
+			WriteIndent(Out_OStream, In_IndentDepth);
+			Out_OStream << In_Text.substr(pos, end - pos) << "\n";
+			pos = end + 1;
+		}
+	}
+
+	// Cfgp̋󔒂ꎞ炸ɏo܂B
+	static inline void WriteIndent(std::ostream& Out_OStream, _In_ int In_IndentDepth)
+	{
+		static constexpr char Spaces[] = "                                ";
+		while (In_IndentDepth > 0)
+		{
+			const int count = (std::min)(In_IndentDepth, static_cast<int>(sizeof(Spaces) - 1));
+			Out_OStream.write(Spaces, count);
+			In_IndentDepth -= count;
+		}
+	}
+
+	inline const YAMLNumericArray* FindNumericArray(_In_ const std::string& In_KeyPath, _In_ const YAMLNumericArray::ElementType& In_ElementType) const
+	{
+		const YAMLNode* node = FindIndexedNode(In_KeyPath);
+		std::shared_ptr<YAMLNode> found;
+		if (!node)
+		{
+			const YAMLNode* current = &m_YAMLData;
+			size_t pos = 0, next;
+			while (current && pos < In_KeyPath.size())
+			{
+				next = In_KeyPath.find('.', pos);
+				const YAMLString token(std::string_view(In_KeyPath).substr(pos, next == std::string::npos ? std::string::npos : next - pos));
+				if (current->type == YAMLNode::Type::Map)
+				{
+					const auto& map = std::get<YAMLMap>(current->value);
+					const auto itr = map.find(token);
+					current = (itr == map.end()) ? nullptr : itr->second.get();
+				}
+				else if (current->type == YAMLNode::Type::Sequence && std::all_of(token.begin(), token.end(), ::isdigit))
+				{
+					const auto& seq = std::get<YAMLSeq>(current->value);
+					const size_t idx = ToIndex(token);
+					current = (idx < seq.size()) ? seq[idx].get() : nullptr;
+				}
+				else
+				{
+					current = nullptr;
+				}
+				if (next == std::string::npos) break;
+				pos = next + 1;
+			}
+			node = current;
+		}
+		if (!node || node->type != YAMLNode::Type::NumericArray) return nullptr;
+		const auto& array = std::get<YAMLNumericArray>(node->value);
+		return (array.elementType == In_ElementType) ? &array : nullptr;
+	}
+
+	/// <summary>
+	/// L[pX̃XJ[܂BȂꍇ nullptr Ԃ܂B
+	/// lz̗vf̓m[hȂ߁A\L Out_Element ɏoẴAhXԂ܂B
+	/// </summary>
+	/// <param name="Out_Element">lz̗vf̕\L̏oBĂяo̕ϐnĂB</param>
+	inline const YAMLScalar* FindScalarByPath(_In_ const std::string& In_KeyPath, _Inout_ YAMLScalar* Out_Element) const
+	{
+		if (const YAMLNode* indexed = FindIndexedNode(In_KeyPath))
+			return (indexed->type == YAMLNode::Type::Scalar) ? &std::get<YAMLScalar>(indexed->value) : nullptr;
+
+		const YAMLNode* node = &m_YAMLData;
+		size_t pos = 0, next;
+		while (pos < In_KeyPath.size())
+		{
+			next = In_KeyPath.find('.', pos);
+			const YAMLString token(std::string_view(In_KeyPath).substr(pos, next == std::string::npos ? std::string::npos : next - pos));
+
+			if (node->type == YAMLNode::Type::Map)
+			{
+				const auto& map = std::get<YAMLMap>(node->value);
+				auto itr = map.find(token);
+				if (itr == map.end()) return nullptr;
+				node = itr->second.get();
+			}
+			else if (node->type == YAMLNode::Type::Sequence)
+			{
+				if (!std::all_of(token.begin(), token.end(), ::isdigit)) return nullptr;
+				const size_t idx = ToIndex(token);
+				const auto& seq = std::get<YAMLSeq>(node->value);
+				if (idx >= seq.size()) return nullptr;
+				node = seq[idx].get();
+			}
+			else if (node->type == YAMLNode::Type::NumericArray)
+			{
+				if (next != std::string::npos || !std::all_of(token.begin(), token.end(), ::isdigit)) return nullptr;
+				const auto& array = std::get<YAMLNumericArray>(node->value);
+				const size_t idx = ToIndex(token);
+				if (idx >= array.size()) return nullptr;
+				char buffer[YAMLNumericArray::FormatBufferSize];
+				Out_Element->assign(array.Format(idx, buffer));
+				return Out_Element;
+			}
+			else
+			{
+				return nullptr;
+			}
+			if (next == std::string::npos) break;
+			pos = next + 1;
+		}
+		if (node->type == YAMLNode::Type::Scalar)
+		{
+			return &std::get<YAMLScalar>(node->value);
+		}
+		return nullptr;
+	}
+
+	/// <summary>
+	/// ϊς݂̃eLXgp[XAYAMLf[^Ƃĕێ܂B𒴂ꍇ͈ȑOYAMLf[^ێ܂ false Ԃ܂B
+	/// </summary>
+	bool ParseText(_In_ std::string_view In_Text)
+	{
+		YAMLPARSER_STATS(auto phaseStart = std::chrono::steady_clock::now());
+
+		// sƂɕ(es In_Text 𒼐ڎQƂAsƂ̊mۂ͍sȂ)
+		YAMLLines yamlLines;
+		SplitLines(In_Text, yamlLines.lines);
+		YAMLPARSER_STATS(m_Stats.lines = yamlLines.lines.size(); MarkPhase(m_Stats.lineSplitTime, phaseStart));
+		YAMLPARSER_STATS(yamlLines.stats = &m_Stats);
+		yamlLines.limits = m_ParseLimits;
+		yamlLines.diagnostics = &m_Diagnostics;
+		yamlLines.control = m_ParseControl;
+		const auto mapDiagnostics = [&]() { if (!m_Diagnostics.empty()) MapDiagnosticsToSource(In_Text, m_Diagnostics, 0); };
+
+		TreeBuilder builder(m_Resource);
+		builder.denseThreshold = m_DenseArrayThreshold;
+		builder.poolScalars = m_PoolScalars;
+		builder.lines = &yamlLines;
+		YAMLPARSER_STATS(builder.stats = &m_Stats);
+		SourceLayout layout;
+		if (m_KeepSourceSpans)
+		{
+			SourceSpanRecorder<TreeBuilder> recorder(builder, layout, In_Text);
+			if (!ParseDocument(yamlLines, recorder))
+			{
+				mapDiagnostics();
+				return false;
+			}
+			if (!In_Text.empty() && In_Text.back() == '\0') In_Text.remove_suffix(1);
+			layout.text.assign(In_Text.data(), In_Text.size());
+			layout.asciiOnly = std::all_of(In_Text.begin(), In_Text.end(), [](const char In_Char) { return static_cast<unsigned char>(In_Char) < 0x80; });
+		}
+		else if (!ParseDocument(yamlLines, builder))
+		{
+			mapDiagnostics();
+			return false;
+		}
+		mapDiagnostics();
+		if (m_ParseControl && m_ParseControl->onProgress) m_ParseControl->onProgress({ YAMLProgress::Stage::Parse, In_Text.size(), In_Text.size() });
+		AdoptTree(builder, std::move(layout));
+		YAMLPARSER_STATS(MarkPhase(m_Stats.treeBuildTime, phaseStart));
+		return true;
+	}
+
+	// ͂̑傫(0 ͖)ȓm߂܂B
+	static bool CheckTotalBytes(_In_ const uint64_t& In_Size, _In_ const uint64_t& In_MaxBytes, _In_ const std::string& In_Source)
+	{
+		if (In_MaxBytes == 0 || In_Size <= In_MaxBytes) return true;
+		Log(LogLevel::Error, "͂̑傫(" + std::to_string(In_MaxBytes) + "oCg)𒴂Ă܂: " + In_Source);
+		return false;
+	}
+
+	/// <summary>
+	/// ێ\[XXpǂݍ񂾃t@CɌѕtASaveChanges Ńt@C𒼐ڏ悤ɂ܂B
+	/// eLXgt@C̕R[hɖ߂ēɂȂȂꍇ(ϊłȂ܂ޏꍇȂ)̓\[XXpj܂B
+	/// </summary>
+	void BindSourceFile(_In_ const std::string& In_FilePath)
+	{
+		SourceLayout& layout = m_SourceLayout;
+		if (!layout.valid) return;
+		if (!GetSourceIdentity(In_FilePath, layout.fileSize, layout.fileTime) ||
+			(layout.asciiOnly ? layout.text.size() : Convert_ShiftJIS_To_UTF8(layout.text).size()) != layout.fileSize)
+		{
+			Log(LogLevel::Warning, "̕\L𕜌łȂ߁Aۂۑ͍s܂: " + In_FilePath);
+			layout = SourceLayout();
+			return;
+		}
+		layout.filePath = In_FilePath;
+	}
+
+	/// <summary>
+	/// ̕\L In_Original ̒l In_Value ɍւ\L܂B
+	/// Vlps̃RgȂꍇ́A̕\L̂̂p܂B
+	/// </summary>
+	static std::string RewriteScalarText(_In_ std::string_view In_Original, _In_ std::string_view In_Value)
+	{
+		// s̃Rg(p̊OɂA󔒂ɑ #)؂蕪
+		std::string_view body = In_Original;
+		char quote = 0;
+		for (size_t i = 0; i < In_Original.size(); ++i)
+		{
+			const char c = In_Original[i];
+			if (quote)
+			{
+				if (c == quote) quote = 0;
+			}
+			else if ((c == '"' || c == '\'') && i == 0)
+			{
+				quote = c;
+			}
+			else if (c == '#' && i > 0 && (In_Original[i - 1] == ' ' || In_Original[i - 1] == '\t'))
+			{
+				body = In_Original.substr(0, i);
+				while (!body.empty() && (body.back() == ' ' || body.back() == '\t')) body.remove_suffix(1);
+				break;
+			}
+		}
+		const std::string_view comment = In_Original.substr(body.size());
+
+		std::string result;
+		const char bodyQuote = (body.size() >= 2 && (body[0] == '"' || body[0] == '\'') && body.back() == body[0]) ? body[0] : 0;
+		if (bodyQuote && (In_Value.empty() || (In_Value[0] != '"' && In_Value[0] != '\'')) &&
+			In_Value.find(bodyQuote) == std::string_view::npos && In_Value.find('\\') == std::string_view::npos)
+		{
+			result += bodyQuote;
+			result += In_Value;
+			result += bodyQuote;
+		}
+		else
+		{
+			result.assign(In_Value.data(), In_Value.size());
+		}
+		if (!comment.empty() && In_Value.find('#') == std::string_view::npos) result += comment;
+		return result;
+	}
+
+	// \[XXp̒ľ̕\L擾܂B
+	inline std::string_view SourceText(_In_ const SourceSpan& In_Span) const noexcept
+	{
+		return std::string_view(In_Span.inText ? m_SourceLayout.text : m_SourceLayout.detached).substr(In_Span.offset, In_Span.size);
+	}
+
+	/// <summary>
+	/// l̕\Lǂݍ񂾂Ƃ̕\LƔׁAςl̍ւW߂܂B
+	/// </summary>
+	/// <param name="In_Path">m[h̃pXBqvfHԂ͏邪A߂ƂɌɖ߂B</param>
+	/// <returns>ׂĂ̕ύXl̍ւŕ\ꍇ trueAL[̒ǉ^̕ύXȂǂꍇ false Ԃ܂B</returns>
+	bool CollectSourceEdits(_In_ const YAMLNode& In_Node, _Inout_ std::string& In_Path, _Inout_ std::vector<SourceEdit>& Out_Edits) const
+	{
+		if (In_Node.type == YAMLNode::Type::Scalar)
+		{
+			const auto itr = m_SourceLayout.scalars.find(In_Path);
+			return itr != m_SourceLayout.scalars.end() && CollectScalarEdit(itr->second, std::get<YAMLScalar>(In_Node.value), In_Node.multilineType, Out_Edits);
+		}
+
+		const auto itr = m_SourceLayout.containers.find(In_Path);
+		if (itr == m_SourceLayout.containers.end()) return false;
+		// lz͓ǂݍ񂾂Ƃ̓V[PX
+		const YAMLNode::Type type = (In_Node.type == YAMLNode::Type::NumericArray) ? YAMLNode::Type::Sequence : In_Node.type;
+		if (itr->second.type != type) return false;
+
+		const size_t pathSize = In_Path.size();
+		const auto enter = [&In_Path, pathSize](std::string_view In_Token)
+			{
+				In_Path.resize(pathSize);
+				if (pathSize > 0) In_Path += '.';
+				In_Path += In_Token;
+			};
+		bool result = true;
+		switch (In_Node.type)
+		{
+		case YAMLNode::Type::Map:
+		{
+			const auto& map = std::get<YAMLMap>(In_Node.value);
+			if (map.size() != itr->second.count) return false;
+			for (const auto& keyValue : map)
+			{
+				enter(keyValue.first);
+				if (!(result = CollectSourceEdits(*keyValue.second, In_Path, Out_Edits))) break;
+			}
+			break;
+		}
+		case YAMLNode::Type::Sequence:
+		{
+			const auto& seq = std::get<YAMLSeq>(In_Node.value);
+			if (seq.size() != itr->second.count) return false;
+			for (size_t i = 0; i < seq.size() && result; ++i)
+			{
+				enter(std::to_string(i));
+				result = CollectSourceEdits(*seq[i], In_Path, Out_Edits);
+			}
+			break;
+		}
+		case YAMLNode::Type::NumericArray:
+		{
+			const auto& array = std::get<YAMLNumericArray>(In_Node.value);
+			if (array.size() != itr->second.count) return false;
+			char buffer[YAMLNumericArray::FormatBufferSize];
+			for (size_t i = 0; i < array.size() && result; ++i)
+			{
+				enter(std::to_string(i));
+				const auto span = m_SourceLayout.scalars.find(In_Path);
+				result = span != m_SourceLayout.scalars.end() && CollectScalarEdit(span->second, array.Format(i, buffer), YAMLNode::MultilineType::None, Out_Edits);
+			}
+			break;
+		}
+		default:
+			break;
+		}
+		In_Path.resize(pathSize);
+		return result;
+	}
+
+	bool CollectScalarEdit(_In_ const SourceSpan& In_Span, _In_ std::string_view In_Value, _In_ const YAMLNode::MultilineType& In_MultilineType,
+		_Inout_ std::vector<SourceEdit>& Out_Edits) const
+	{
+		const std::string_view original = SourceText(In_Span);
+		if (In_Value == original) return true;
+		// sXJ[AeLXgɌȂl͕\LgݗĒȂ
+		if (!In_Span.inText || In_MultilineType != YAMLNode::MultilineType::None ||
+			In_Value.find_first_of("\r\n") != std::string_view::npos) return false;
+		std::string text = RewriteScalarText(original, In_Value);
+		if (text != original) Out_Edits.push_back({ In_Span.offset, In_Span.size, std::move(text) });
+		return true;
+	}
+
+	/// <summary>
+	/// l̍ւۑɏ݁AێĂeLXgƃ\[XXp񂾓eɍ킹܂B
+	/// </summary>
+	/// <param name="In_Edits">ʒȕɕׂւB</param>
+	bool WriteSourceEdits(_In_ const std::string& In_FilePath, _In_ const std::vector<SourceEdit>& In_Edits)
+	{
+		SourceLayout& layout = m_SourceLayout;
+		std::string text;
+		text.reserve(layout.text.size());
+		size_t pos = 0;
+		for (const SourceEdit& edit : In_Edits)
+		{
+			text.append(layout.text, pos, edit.offset - pos);
+			text += edit.text;
+			pos = edit.offset + edit.size;
+		}
+		text.append(layout.text, pos, std::string::npos);
+
+		// ǂݍ񂾃t@ČύXĂȂ΁Aς
+		uint64_t size = 0;
+		int64_t time = 0;
+		std::error_code ec;
+		const bool inPlace = !layout.filePath.empty() && GetSourceIdentity(In_FilePath, size, time) &&
+			size == layout.fileSize && time == layout.fileTime && std::filesystem::equivalent(layout.filePath, In_FilePath, ec);
+		if (inPlace)
+		{
+			if (!PatchSourceFile(In_FilePath, In_Edits, text)) return false;
+		}
+		else
+		{
+			std::ofstream ofs;
+			if (!OpenOutputFile(In_FilePath, ofs)) return false;
+			const std::string encoded = layout.asciiOnly ? std::string() : Convert_ShiftJIS_To_UTF8(text);
+			const std::string& output = layout.asciiOnly ? text : encoded;
+			ofs.write(output.data(), static_cast<std::streamsize>(output.size()));
+			if (!ofs)
+			{
+				Log(LogLevel::Error, "t@C݃G[: " + In_FilePath);
+				return false;
+			}
+		}
+
+		// ւl̒XVA̒l̈ʒu炷
+		std::vector<ptrdiff_t> deltas;	// eւ܂ł̒̕ω̗݌v
+		deltas.reserve(In_Edits.size());
+		ptrdiff_t delta = 0;
+		for (const SourceEdit& edit : In_Edits)
+		{
+			delta += static_cast<ptrdiff_t>(edit.text.size()) - static_cast<ptrdiff_t>(edit.size);
+			deltas.push_back(delta);
+		}
+		for (auto& keyValue : layout.scalars)
+		{
+			SourceSpan& span = keyValue.second;
+			if (!span.inText) continue;
+			// lOn܂鍷ւ̈ʒu炷(0̍ւ͏I肪l̐擪ƏdȂ邽߁An܂Ŕ肷)
+			const auto edit = std::lower_bound(In_Edits.begin(), In_Edits.end(), span.offset,
+				[](const SourceEdit& In_Edit, const size_t& In_Offset) { return In_Edit.offset < In_Offset; });
+			const size_t before = static_cast<size_t>(edit - In_Edits.begin());
+			if (edit != In_Edits.end() && edit->offset == span.offset) span.size = edit->text.size();
+			if (before != 0) span.offset = static_cast<size_t>(static_cast<ptrdiff_t>(span.offset) + deltas[before - 1]);
+		}
+		layout.text = std::move(text);
+		layout.filePath = In_FilePath;
+		GetSourceIdentity(In_FilePath, layout.fileSize, layout.fileTime);
+		return true;
+	}
+
+	/// <summary>
+	/// ǂݍ񂾃t@C𒼐ڏ܂BׂĂ̍ւŒςȂ΂̉ӏ㏑A
+	/// łȂ΍ŏɒςʒuăt@C̒킹܂B
+	/// </summary>
+	/// <param name="In_Text">ւ̃eLXgŚB</param>
+	bool PatchSourceFile(_In_ const std::string& In_FilePath, _In_ const std::vector<SourceEdit>& In_Edits, _In_ const std::string& In_Text) const
+	{
+		if (In_Edits.empty()) return true;
+		const SourceLayout& layout = m_SourceLayout;
+		const auto encode = [&layout](std::string_view In_Source) { return layout.asciiOnly ? std::string(In_Source) : Convert_ShiftJIS_To_UTF8(In_Source); };
+		const auto encodedSize = [&layout, &encode](std::string_view In_Source) { return layout.asciiOnly ? In_Source.size() : encode(In_Source).size(); };
+
+		std::fstream fs(In_FilePath, std::ios::in | std::ios::out | std::ios::binary);
+		if (!fs)
+		{
+			Log(LogLevel::Error, "t@Cۑł܂: " + In_FilePath);
+			return false;
+		}
+
+		// t@C̈ʒu̓eLXg̈ʒu當R[ḧႢlċ߂
+		uint64_t fileOffset = 0;
+		size_t textOffset = 0;		// ւ̃eLXg̈ʒu
+		size_t pos = 0;				// ւÕeLXg̈ʒu
+		for (const SourceEdit& edit : In_Edits)
+		{
+			const std::string_view unchanged = std::string_view(layout.text).substr(pos, edit.offset - pos);
+			fileOffset += encodedSize(unchanged);
+			textOffset += unchanged.size();
+			const std::string encoded = encode(edit.text);
+			const size_t originalSize = encodedSize(std::string_view(layout.text).substr(edit.offset, edit.size));
+			if (encoded.size() != originalSize)
+			{
+				const std::string tail = encode(std::string_view(In_Text).substr(textOffset));
+				fs.seekp(static_cast<std::streamoff>(fileOffset));
+				fs.write(tail.data(), static_cast<std::streamsize>(tail.size()));
+				fs.close();
+				const uint64_t newSize = fileOffset + tail.size();
+				std::error_code ec;
+				if (fs.fail() || (newSize < layout.fileSize && (std::filesystem::resize_file(In_FilePath, newSize, ec), ec)))
+				{
+					Log(LogLevel::Error, "t@C݃G[: " + In_FilePath);
+					return false;
+				}
+				return true;
+			}
+			fs.seekp(static_cast<std::streamoff>(fileOffset));
+			fs.write(encoded.data(), static_cast<std::streamsize>(encoded.size()));
+			fileOffset += originalSize;
+			textOffset += edit.text.size();
+			pos = edit.offset + edit.size;
+		}
+		if (!fs)
+		{
+			Log(LogLevel::Error, "t@C݃G[: " + In_FilePath);
+			return false;
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// t@Cǂݍ݁Ap[XɎgR[h֕ϊeLXg擾܂B
+	/// </summary>
+	/// <param name="In_MaxBytes">t@C̑傫̏(0 ͖)Bꍇ͓ǂݍ܂Ɏs܂B</param>
+	static bool ReadText(_In_ const std::string& In_FilePath, _In_ const uint64_t& In_MaxBytes, _Out_ std::string& Out_Text
+		YAMLPARSER_STATS(, _Inout_opt_ YAMLStats* Out_Stats = nullptr))
+	{
+		YAMLPARSER_STATS(auto phaseStart = std::chrono::steady_clock::now());
+
+		std::ifstream ifs(In_FilePath, std::ios::binary);
+		if (!ifs)
+		{
+			Log(LogLevel::Error, "t@CJ܂: " + In_FilePath);
+			return false;
+		}
+		if (In_MaxBytes != 0)
+		{
+			ifs.seekg(0, std::ios::end);
+			if (!CheckTotalBytes(static_cast<uint64_t>(ifs.tellg()), In_MaxBytes, In_FilePath)) return false;
+			ifs.seekg(0, std::ios::beg);
+		}
+
+		// f[^̓ǂݍ
+		std::ostringstream buffer;
+		buffer << ifs.rdbuf();
+		YAMLPARSER_STATS(if (Out_Stats) { Out_Stats->bytesRead = static_cast<uint64_t>(buffer.tellp()); MarkPhase(Out_Stats->readTime, phaseStart); });
+
+		// UTF-8Shift_JISւ̕ϊ
+		Out_Text = Convert_UTF8_To_ShiftJIS(buffer.str());
+		YAMLPARSER_STATS(if (Out_Stats) MarkPhase(Out_Stats->transcodeTime, phaseStart));
+		return true;
+	}
+
+	static LogSink& GetLogSinkStorage()
+	{
+		static LogSink sink;
+		return sink;
+	}
+
+#if defined(YAMLPARSER_ENABLE_STATS)
+	static inline void MarkPhase(_Inout_ std::chrono::nanoseconds& Out_Elapsed,
+		_Inout_ std::chrono::steady_clock::time_point& In_PhaseStart) noexcept
+	{
+		const auto now = std::chrono::steady_clock::now();
+		Out_Elapsed += std::chrono::duration_cast<std::chrono::nanoseconds>(now - In_PhaseStart);
+		In_PhaseStart = now;
+	}
+
+	/// <summary>
+	/// m[h1̎ނƃq[vmۗʂ𓝌vɉZ܂Bqm[h͊܂݂܂B
+	/// </summary>
+	static void CountNode(_Inout_ YAMLStats& Out_Stats, _In_ const YAMLNode& In_Node) noexcept
+	{
+		const auto countString = [&Out_Stats](const YAMLString& In_Str) noexcept
+			{
+				if (In_Str.capacity() <= YAMLString().capacity()) return;
+				++Out_Stats.allocations;
+				Out_Stats.allocatedBytes += In_Str.capacity() + 1;
+			};
+
+		++Out_Stats.allocations;
+		Out_Stats.allocatedBytes += sizeof(YAMLNode) + 2 * sizeof(void*);
+		switch (In_Node.type)
+		{
+		case YAMLNode::Type::Scalar:
+			++Out_Stats.scalarNodes;
+			countString(std::get<YAMLScalar>(In_Node.value));
+			break;
+		case YAMLNode::Type::Sequence:
+		{
+			++Out_Stats.sequenceNodes;
+			const auto& seq = std::get<YAMLSeq>(In_Node.value);
+			if (seq.capacity() == 0) break;
+			++Out_Stats.allocations;
+			Out_Stats.allocatedBytes += seq.capacity() * sizeof(YAMLSeq::value_type);
+			break;
+		}
+		case YAMLNode::Type::Map:
+		{
+			++Out_Stats.mapNodes;
+			const auto& map = std::get<YAMLMap>(In_Node.value);
+			++Out_Stats.allocations;
+			Out_Stats.allocatedBytes += map.bucket_count() * sizeof(void*);
+			Out_Stats.allocations += map.size();
+			Out_Stats.allocatedBytes += map.size() * (sizeof(YAMLMap::value_type) + 2 * sizeof(void*));
+			for (const auto& keyValue : map) countString(keyValue.first);
+			break;
+		}
+		case YAMLNode::Type::NumericArray:
+		{
+			++Out_Stats.sequenceNodes;
+			const auto& array = std::get<YAMLNumericArray>(In_Node.value);
+			const size_t capacity = array.ints.capacity() + array.doubles.capacity();
+			if (capacity == 0) break;
+			++Out_Stats.allocations;
+			Out_Stats.allocatedBytes += capacity * sizeof(int64_t);
+			break;
+		}
+		}
+	}
+#endif
+
+	/// <summary>
+	/// pXCfbNXm[h܂BCfbNXA܂͖o^̏ꍇ nullptr Ԃ܂B
+	/// </summary>
+	inline YAMLNode* FindIndexedNode(_In_ const std::string& In_KeyPath) const
+	{
+		if (!m_UsePathIndex) return nullptr;
+		const auto itr = m_PathIndex.find(In_KeyPath);
+		if (itr != m_PathIndex.end()) return itr->second;
+		for (const PathIndexLayer* layer = m_SharedPathIndex.get(); layer; layer = layer->below.get())
+		{
+			const auto shared = layer->entries.find(In_KeyPath);
+			if (shared != layer->entries.end()) return shared->second;
+		}
+		return nullptr;
+	}
+
+	// pXCfbNXGg菜܂BpwɂGg nullptr ŉB܂B
+	inline void UnindexPath(_In_ const std::string& In_Path)
+	{
+		if (m_SharedPathIndex) m_PathIndex[In_Path] = nullptr;
+		else m_PathIndex.erase(In_Path);
+	}
+
+	/// <summary>
+	/// ̃p[T[̃pXCfbNXAFork ƋLłwƂĕԂ܂B
+	/// g̕ύXVwɕȂw̑w̔ȏ̑傫ɂȂ牺̑wƂ܂Ƃ߂܂B
+	/// ̂ߑw̐̓Gg̑ΐxɎ܂AFork JԂĂ1Gg̕񐔂͑ΐxłB
+	/// </summary>
+	std::shared_ptr<const PathIndexLayer> SharePathIndex() const
+	{
+		if (m_PathIndex.empty()) return m_SharedPathIndex;
+		auto layer = std::make_shared<PathIndexLayer>();
+		layer->entries = m_PathIndex;
+		layer->below = m_SharedPathIndex;
+		while (layer->below && layer->entries.size() * 2 >= layer->below->entries.size())
+		{
+			const PathIndexLayer& below = *layer->below;
+			PathIndexMap merged = below.entries;
+			for (const auto& entry : layer->entries)
+				merged.insert_or_assign(entry.first, entry.second);
+			layer->entries = std::move(merged);
+			layer->below = below.below;
+		}
+		// ŉwł͉B肪Ȃ߁A폜ς݂͕̈sv
+		if (!layer->below)
+		{
+			for (auto itr = layer->entries.begin(); itr != layer->entries.end();)
+				itr = (itr->second == nullptr) ? layer->entries.erase(itr) : std::next(itr);
+		}
+		return layer;
+	}
+
+	static inline size_t EstimatePathIndexMemory(_In_ const PathIndexMap& In_Index) noexcept
+	{
+		return In_Index.bucket_count() * sizeof(void*) + In_Index.size() * (sizeof(PathIndexMap::value_type) + 2 * sizeof(void*));
+	}
+
+	static inline std::string JoinPath(_In_ const std::string& In_Parent, _In_ std::string_view In_Token)
+	{
+		std::string path;
+		path.reserve(In_Parent.size() + 1 + In_Token.size());
+		if (!In_Parent.empty())
+		{
+			path += In_Parent;
+			path += '.';
+		}
+		path += In_Token;
+		return path;
+	}
+
+	// pXƂĒHȂL[(󕶎hbg܂ނ)̓CfbNXɍڂ܂B
+	static inline bool IsIndexableKey(_In_ std::string_view In_Key) noexcept
+	{
+		return !In_Key.empty() && In_Key.find('.') == std::string_view::npos;
+	}
+
+	// L[pX̃V[PX̓Y𐔒lɕϊ܂BȊO܂ޏꍇ std::invalid_argument 𑗏o܂B
+	static inline size_t ToIndex(_In_ std::string_view In_Token)
+	{
+		size_t idx = 0;
+		const auto [ptr, ec] = std::from_chars(In_Token.data(), In_Token.data() + In_Token.size(), idx, 10);
+		if (ec == std::errc::result_out_of_range) throw std::out_of_range("YAML: V[PX̓Y傫܂");
+		if (ec != std::errc() || ptr != In_Token.data() + In_Token.size()) throw std::invalid_argument("YAML: V[PX̓Ysł");
+		return idx;
+	}
+
+	// m[h̒lw肵^̋̒lɒu܂B
+	inline void ResetNodeValue(_Inout_ YAMLNode& Out_Node, _In_ const YAMLNode::Type& In_Type)
+	{
+		switch (In_Type)
+		{
+		case YAMLNode::Type::Scalar:
+			Out_Node.value = YAMLScalar(m_Resource);
+			break;
+		case YAMLNode::Type::Map:
+			Out_Node.value = YAMLMap(m_Resource);
+			break;
+		case YAMLNode::Type::Sequence:
+			Out_Node.value = YAMLSeq(m_Resource);
+			break;
+		case YAMLNode::Type::NumericArray:
+			Out_Node.value = YAMLNumericArray(m_Resource);
+			break;
+		}
+	}
+
+	/// <summary>
+	/// w肳ꂽ\[Xm[hmۂ܂BubN\[Xmۂ܂B
+	/// </summary>
+	template <class... Args>
+	static inline std::shared_ptr<YAMLNode> AllocateNode(_In_ std::pmr::memory_resource* In_Resource, Args&&... In_Args)
+	{
+		return std::allocate_shared<YAMLNode>(std::pmr::polymorphic_allocator<YAMLNode>(In_Resource), std::forward<Args>(In_Args)...);
+	}
+
+	// }bvɃL[Ǝqm[hݒ肵܂BL[̓}bvƓ\[XɊmۂ܂B
+	static inline void SetMapEntry(_Inout_ YAMLMap& Out_Map, _In_ std::string_view In_Key, _In_ std::shared_ptr<YAMLNode> In_Node)
+	{
+		Out_Map.insert_or_assign(YAMLString(In_Key, Out_Map.get_allocator().resource()), std::move(In_Node));
+	}
+
+	inline void IndexNode(_In_ const std::string& In_Path, _In_ YAMLNode* In_Node)
+	{
+		if (m_UsePathIndex) m_PathIndex[In_Path] = In_Node;
+	}
+
+	/// <summary>
+	/// Ώۂ̎qm[h̃c[(Rs[̃p[T[Jς݂̃XibvVbg)ƋLĂΕA
+	/// ̃c[p̃m[hԂ܂B͐󂭁Aq͈L܂(Rs[ICg)B
+	/// </summary>
+	inline YAMLNode* DetachShared(_Inout_ std::shared_ptr<YAMLNode>& In_Child, _In_ const std::string& In_IndexPath, _In_ const bool& In_Indexable)
+	{
+		if (In_Child.use_count() > 1)
+		{
+			In_Child = AllocateNode(m_Resource, *In_Child, m_Resource);
+			if (In_Indexable) IndexNode(In_IndexPath, In_Child.get());
+		}
+		// pX̃m[hȂ̂ŁAL^nbVlj
+		In_Child->InvalidateHash();
+		return In_Child.get();
+	}
+
+	/// <summary>
+	/// wm[hz̎qm[hׂăpXCfbNXɓo^܂B
+	/// </summary>
+	void IndexChildren(_In_ const std::string& In_Path, _In_ YAMLNode& In_Node)
+	{
+		if (!m_UsePathIndex) return;
+		if (In_Node.type == YAMLNode::Type::Map)
+		{
+			for (const auto& keyValue : std::get<YAMLMap>(In_Node.value))
+			{
+				if (!IsIndexableKey(keyValue.first)) continue;
+				const std::string childPath = JoinPath(In_Path, keyValue.first);
+				m_PathIndex[childPath] = keyValue.second.get();
+				IndexChildren(childPath, *keyValue.second);
+			}
+		}
+		else if (In_Node.type == YAMLNode::Type::Sequence)
+		{
+			const auto& seq = std::get<YAMLSeq>(In_Node.value);
+			for (size_t i = 0; i < seq.size(); ++i)
+			{
+				const std::string childPath = JoinPath(In_Path, std::to_string(i));
+				m_PathIndex[childPath] = seq[i].get();
+				IndexChildren(childPath, *seq[i]);
+			}
+		}
+	}
+
+	/// <summary>
+	/// wm[hz̎qm[hpXCfbNX菜܂Bm[hg̃Gg͎c܂B
+	/// </summary>
+	void UnindexChildren(_In_ const std::string& In_Path, _In_ const YAMLNode& In_Node)
+	{
+		if (!m_UsePathIndex) return;
+		if (In_Node.type == YAMLNode::Type::Map)
+		{
+			for (const auto& keyValue : std::get<YAMLMap>(In_Node.value))
+			{
+				if (!IsIndexableKey(keyValue.first)) continue;
+				const std::string childPath = JoinPath(In_Path, keyValue.first);
+				UnindexPath(childPath);
+				UnindexChildren(childPath, *keyValue.second);
+			}
+		}
+		else if (In_Node.type == YAMLNode::Type::Sequence)
+		{
+			const auto& seq = std::get<YAMLSeq>(In_Node.value);
+			for (size_t i = 0; i < seq.size(); ++i)
+			{
+				const std::string childPath = JoinPath(In_Path, std::to_string(i));
+				UnindexPath(childPath);
+				UnindexChildren(childPath, *seq[i]);
+			}
+		}
+	}
+
+	static void DiffNodes(_In_ const YAMLNode& In_Old, _In_ const YAMLNode& In_New,
+		_In_ const std::string& In_Path, _Inout_ std::vector<YAMLChange>& Out_Changes)
+	{
+		if (&In_Old == &In_New) return;	// LꂽTuc[͔rsv
+		if (In_Old.GetHash() == In_New.GetHash()) return;	// eTuc[͔rsv
+		if (In_Old.type == YAMLNode::Type::NumericArray || In_New.type == YAMLNode::Type::NumericArray)
+		{
+			// lz͕\LȂ瓯l̂߁AzłȂΒʏ̃V[PXɓWJėvfƂɔr
+			if (In_Old.type == In_New.type && IsSameArray(std::get<YAMLNumericArray>(In_Old.value), std::get<YAMLNumericArray>(In_New.value))) return;
+			const auto expand = [](const YAMLNode& In_Node)
+				{
+					return (In_Node.type == YAMLNode::Type::NumericArray)
+						? YAMLNode(ToSequence(std::get<YAMLNumericArray>(In_Node.value), std::pmr::get_default_resource()))
+						: In_Node;
+				};
+			DiffNodes(expand(In_Old), expand(In_New), In_Path, Out_Changes);
+			return;
+		}
+		if (In_Old.type != In_New.type)
+		{
+			Out_Changes.push_back({ YAMLChange::Kind::Changed, In_Path });
+			return;
+		}
+
+		switch (In_Old.type)
+		{
+		case YAMLNode::Type::Scalar:
+			if (In_Old.multilineType != In_New.multilineType ||
+				std::get<YAMLScalar>(In_Old.value) != std::get<YAMLScalar>(In_New.value))
+				Out_Changes.push_back({ YAMLChange::Kind::Changed, In_Path });
+			break;
+		case YAMLNode::Type::Sequence:
+		{
+			const auto& oldSeq = std::get<YAMLSeq>(In_Old.value);
+			const auto& newSeq = std::get<YAMLSeq>(In_New.value);
+			const size_t common = (std::min)(oldSeq.size(), newSeq.size());
+			for (size_t i = 0; i < common; ++i)
+				DiffNodes(*oldSeq[i], *newSeq[i], JoinPath(In_Path, std::to_string(i)), Out_Changes);
+			for (size_t i = common; i < oldSeq.size(); ++i)
+				Out_Changes.push_back({ YAMLChange::Kind::Removed, JoinPath(In_Path, std::to_string(i)) });
+			for (size_t i = common; i < newSeq.size(); ++i)
+				Out_Changes.push_back({ YAMLChange::Kind::Added, JoinPath(In_Path, std::to_string(i)) });
+			break;
+		}
+		case YAMLNode::Type::Map:
+		{
+			const auto& oldMap = std::get<YAMLMap>(In_Old.value);
+			const auto& newMap = std::get<YAMLMap>(In_New.value);
+			for (const auto& keyValue : oldMap)
+			{
+				const auto itr = newMap.find(keyValue.first);
+				if (itr == newMap.end())
+					Out_Changes.push_back({ YAMLChange::Kind::Removed, JoinPath(In_Path, keyValue.first) });
+				else
+					DiffNodes(*keyValue.second, *itr->second, JoinPath(In_Path, keyValue.first), Out_Changes);
+			}
+			for (const auto& keyValue : newMap)
+			{
+				if (oldMap.find(keyValue.first) == oldMap.end())
+					Out_Changes.push_back({ YAMLChange::Kind::Added, JoinPath(In_Path, keyValue.first) });
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	static inline bool IsSameArray(_In_ const YAMLNumericArray& In_Left, _In_ const YAMLNumericArray& In_Right) noexcept
+	{
+		return In_Left.elementType == In_Right.elementType && In_Left.precision == In_Right.precision &&
+			std::equal(In_Left.ints.begin(), In_Left.ints.end(), In_Right.ints.begin(), In_Right.ints.end()) &&
+			std::equal(In_Left.doubles.begin(), In_Left.doubles.end(), In_Right.doubles.begin(), In_Right.doubles.end());
+	}
+
+	// lz̊evfXJ[m[hɂV[PX쐬܂B
+	static YAMLSeq ToSequence(_In_ const YAMLNumericArray& In_Array, _In_ std::pmr::memory_resource* In_Resource)
+	{
+		YAMLSeq seq(In_Resource);
+		seq.reserve(In_Array.size());
+		char buffer[YAMLNumericArray::FormatBufferSize];
+		for (size_t i = 0; i < In_Array.size(); ++i)
+			seq.push_back(AllocateNode(In_Resource, YAMLScalar(In_Array.Format(i, buffer), In_Resource)));
+		return seq;
+	}
+
+	/// <summary>
+	/// ̂߂ɁAlz̃m[hvfƂ̃m[hʏ̃V[PXɒu܂B
+	/// </summary>
+	/// <param name="In_IndexPath">m[h̃pX(pXCfbNX̍XVɎg)B</param>
+	void ExpandNumericArray(_Inout_ YAMLNode& In_Node, _In_ const std::string& In_IndexPath, _In_ const bool& In_Indexable)
+	{
+		In_Node.value = ToSequence(std::get<YAMLNumericArray>(In_Node.value), m_Resource);
+		In_Node.type = YAMLNode::Type::Sequence;
+		if (In_Indexable) IndexChildren(In_IndexPath, In_Node);
+	}
+
+	/// <summary>
+	/// m[hz̃Reiƕ񂪊mۂĂ郁ʂċAIɌς܂B
+	/// ̉ӏ狤LĂm[h(GCAX⋤LXJ[)͍ŏ1񂾂܂B
+	/// </summary>
+	/// <param name="In_Counted">Lm[hB</param>
+	static size_t EstimateNodeMemory(_In_ const YAMLNode& In_Node, _Inout_ std::unordered_set<const YAMLNode*>& In_Counted)
+	{
+		const auto isCounted = [&In_Counted](const std::shared_ptr<YAMLNode>& In_Child)
+			{ return In_Child.use_count() > 1 && !In_Counted.insert(In_Child.get()).second; };
+		// shared_ptroRŊmۂm[h1(ubN܂)
+		constexpr size_t NodeAllocation = sizeof(YAMLNode) + 2 * sizeof(void*);
+		const auto stringMemory = [](const YAMLString& In_Str) noexcept
+			{ return (In_Str.capacity() > YAMLString().capacity()) ? In_Str.capacity() + 1 : 0; };
+
+		size_t total = 0;
+		switch (In_Node.type)
+		{
+		case YAMLNode::Type::Scalar:
+			total += stringMemory(std::get<YAMLScalar>(In_Node.value));
+			break;
+		case YAMLNode::Type::Sequence:
+		{
+			const auto& seq = std::get<YAMLSeq>(In_Node.value);
+			total += seq.capacity() * sizeof(YAMLSeq::value_type);
+			for (const auto& child : seq)
+				if (!isCounted(child)) total += NodeAllocation + EstimateNodeMemory(*child, In_Counted);
+			break;
+		}
+		case YAMLNode::Type::Map:
+		{
+			const auto& map = std::get<YAMLMap>(In_Node.value);
+			total += map.bucket_count() * sizeof(void*);
+			for (const auto& keyValue : map)
+			{
+				total += sizeof(YAMLMap::value_type) + 2 * sizeof(void*) + stringMemory(keyValue.first);
+				if (!isCounted(keyValue.second)) total += NodeAllocation + EstimateNodeMemory(*keyValue.second, In_Counted);
+			}
+			break;
+		}
+		case YAMLNode::Type::NumericArray:
+		{
+			const auto& array = std::get<YAMLNumericArray>(In_Node.value);
+			total += (array.ints.capacity() + array.doubles.capacity()) * sizeof(int64_t);
+			break;
+		}
+		}
+		return total;
+	}
+
+	// oCiXibvVbg̎ʎqƃo[W
+	static constexpr char BinaryMagic[4] = { 'Y', 'M', 'L', 'B' };
+	static constexpr uint32_t BinaryVersion = 3;
+	static constexpr uint32_t BinaryByteOrder = 0x01020304;
+	static constexpr uint32_t BinaryNoKey = UINT32_MAX;
+
+	// oCiXibvVbg̃ZNV̐擪ʒuAł傫Gg̋Eɐ؂グ
+	static constexpr uint64_t AlignBinaryOffset(_In_ const uint64_t& In_Offset) noexcept
 	{
-		return SetString(In_keyPath, std::to_string(In_Value));
+		return (In_Offset + alignof(uint64_t) - 1) / alignof(uint64_t) * alignof(uint64_t);
 	}
 
+	// oCiXibvVbg̃wb_[
+	struct BinaryHeader
+	{
+		char magic[4];
+		uint32_t version;
+		uint32_t byteOrder;
+		uint32_t reserved;
+		uint64_t sourceSize;		// YAMLt@C̃TCY
+		int64_t sourceTime;			// YAMLt@C̍XV
+		uint64_t nodeCount;
+		uint64_t childCount;
+		uint64_t stringCount;
+		uint64_t stringDataSize;
+		uint64_t nodeOffset;
+		uint64_t childOffset;
+		uint64_t stringOffset;
+		uint64_t stringDataOffset;
+	};
+
+	// Rm[hBXJ[͕IDARei͎qz̐擪ʒuƗvfAlz͗vf̃oCg̕IDƗvf
+	struct BinaryNode
+	{
+		uint8_t type;
+		uint8_t multilineType;
+		uint16_t reserved;
+		uint32_t value;
+		uint32_t count;
+	};
+
+	// Rei̎qvfBV[PX̏ꍇ key  BinaryNoKey
+	struct BinaryChild
+	{
+		uint32_t key;
+		uint32_t node;
+	};
+
+	// e[ũGg
+	struct BinaryString
+	{
+		uint64_t offset;
+		uint64_t length;
+	};
+
 	/// <summary>
-	/// w肳ꂽpXɏ]YAMLm[hA̒lݒ肵܂B
+	/// ǂݎp̃}bvgt@CǗ܂B
 	/// </summary>
-	/// <param name="In_keyPath">m[h邽߂̃hbg؂̃L[B</param>
-	/// <param name="In_Node">ݒ肷lYAMLm[hւ̋L|C^B</param>
-	/// <returns>l̐ݒ肪ꍇtrueAsꍇfalseԂ܂B</returns>
-	bool SetNodeByPath(_In_ const std::string& In_keyPath, _In_ const std::shared_ptr<YAMLNode>& In_Node)
+	class MappedFile
 	{
-		YAMLNode* node = &m_YAMLData;
-		size_t pos = 0, next;
-		while (pos < In_keyPath.size())
+	public:
+		MappedFile() = default;
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		~MappedFile() { Close(); }
+
+		bool Open(_In_ const std::string& In_FilePath)
 		{
-			next = In_keyPath.find('.', pos);
-			const std::string token = In_keyPath.substr(pos, next == std::string::npos ? std::string::npos : next - pos);
-			if (node->type == YAMLNode::Type::Map)
+			Close();
+			m_File = CreateFileA(In_FilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+			if (m_File == INVALID_HANDLE_VALUE) return false;
+
+			LARGE_INTEGER fileSize;
+			if (!GetFileSizeEx(m_File, &fileSize) || fileSize.QuadPart == 0)
 			{
-				auto& map = std::get<YAMLMap>(node->value);
-				auto itr = map.find(token);
-				if (itr == map.end())
-				{
-					map[token] = std::make_shared<YAMLNode>(YAMLScalar{});
-					itr = map.find(token);
-				}
-				node = itr->second.get();
+				Close();
+				return false;
 			}
-			else if (node->type == YAMLNode::Type::Sequence)
+			m_Size = static_cast<size_t>(fileSize.QuadPart);
+
+			m_Mapping = CreateFileMappingA(m_File, NULL, PAGE_READONLY, 0, 0, NULL);
+			if (!m_Mapping)
 			{
-				if (!std::all_of(token.begin(), token.end(), ::isdigit)) return false;
-				const size_t idx = std::stoul(token);
-				auto& seq = std::get<YAMLSeq>(node->value);
-				if (idx >= seq.size())
-				{
-					return false; // CfbNX͈͊O
-				}
-				node = seq[idx].get();
+				Close();
+				return false;
 			}
-			else
+			m_Data = static_cast<const char*>(MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0));
+			if (!m_Data)
 			{
-				return false; // }bvV[PXł͂Ȃꍇ
+				Close();
+				return false;
 			}
-			if (next == std::string::npos) break;
-			pos = next + 1;
+			return true;
 		}
-		if (node->type != YAMLNode::Type::Map && node->type != YAMLNode::Type::Sequence) return false; // ŏIm[h}bvV[PXłȂꍇ
-		node->value = In_Node->value; // lݒ
-		node->type = In_Node->type;
-		node->multilineType = In_Node->multilineType;
-		return true;
-	}
+
+		void Close() noexcept
+		{
+			if (m_Data) UnmapViewOfFile(m_Data);
+			if (m_Mapping) CloseHandle(m_Mapping);
+			if (m_File != INVALID_HANDLE_VALUE) CloseHandle(m_File);
+			m_Data = nullptr;
+			m_Mapping = NULL;
+			m_File = INVALID_HANDLE_VALUE;
+			m_Size = 0;
+		}
+
+		inline const char* data() const noexcept { return m_Data; }
+		inline size_t size() const noexcept { return m_Size; }
+
+	private:
+		HANDLE m_File = INVALID_HANDLE_VALUE;
+		HANDLE m_Mapping = NULL;
+		const char* m_Data = nullptr;
+		size_t m_Size = 0;
+	};
+
+	/// YAMLt@C̍sǗÄ݂ʒuǐՂ܂B
+	struct YAMLLines
+	{
+		std::vector<std::string_view> lines;	// YAMLt@C̍si[xN^[(ǂݍ񂾃eLXgQƂ)
+		size_t currentPos = 0;					// ݂̍sʒuǐՂCfbNX
+		std::string scratch;					// sXJ[̑gݗėpobt@(p[Xɍėp)
+		YAMLParseLimits limits;					// p[X̏
+		size_t depth = 0;						// ݂̃ReĩlXg[
+		size_t nodes = 0;						// ʒmm[h̐
+		bool failed = false;					// 𒴂ߑł؂ǂ(ȍ~̃Cxg͒ʒmȂ)
+		std::vector<YAMLDiagnostic>* diagnostics = nullptr;	// ̋L^(nullptr ̏ꍇ͋L^Ȃ)
+		const YAMLParseControl* control = nullptr;	// ~vƐi̒ʒm
+		size_t nextControlPos = 0;					// ɒ~vm߂sʒu
+		size_t flowScanEnd = 0;						// ǂݍ݂Ɏst[`̒lpŌ̍s̎̈ʒu
+
+		// ݂̈ʒus𒴂Ă邩ǂmF܂B
+		inline bool eof() const noexcept { return currentPos >= lines.size(); }
+		// ݂̍sʒu擾܂B
+		inline void next() noexcept { ++currentPos; }
+		// ݂̍s擾܂B
+		inline std::string_view peek() const { return lines[currentPos]; }
+
+#if defined(YAMLPARSER_ENABLE_STATS)
+		YAMLStats* stats = nullptr;		// v̎W
+#endif
+	};
 
 	/// <summary>
-	/// w肳ꂽL[̃pXɏ]YAMLm[h𐶐Am[ȟ^ƕs^Cvݒ肵܂B
+	/// p[XɊJĂubN`̃ReiłBParseDocument ͍ċȂɂ̃X^bNŃlXgH܂B
 	/// </summary>
-	/// <param name="In_keyPath">m[h𐶐邽߂̃hbg؂̃L[̃pXB</param>
-	/// <param name="In_Type">m[ȟ^B</param>
-	/// <param name="In_MultilineType">m[h̕s^CvBȗNoneB</param>
-	void GenerateNode(_In_ const std::string& In_keyPath, _In_ const YAMLNode::Type& In_Type,
-		_In_ const YAMLNode::MultilineType& In_MultilineType = YAMLNode::MultilineType::None)
+	struct BlockFrame
 	{
-		YAMLNode* node = &m_YAMLData;
-		size_t pos = 0, next;
-		while (pos < In_keyPath.size())
+		enum class Kind : uint8_t
 		{
-			next = In_keyPath.find('.', pos);
-			const std::string token = In_keyPath.substr(pos, next == std::string::npos ? std::string::npos : next - pos);
+			Document,	// Cfg0̃L[[g̃}bv
+			Map,
+			Seq,
+			SeqItemMap	// "- key: value" Ŏn܂V[PX̗vf̃}bv
+		};
+		Kind kind;
+		size_t indent;	// vf̃Cfg(SeqItemMap ͐ẽV[PX̃Cfg)
+	};
 
-			try
+	/// <summary>
+	/// p[XCxgʂ̃nh[֒pȂAel̃pXƓǂݍ񂾃eLXg̈ʒu SourceLayout ɋL^܂B
+	/// GCAX}[WL[ꍇ́ApXƒl̈ʒuΉȂߋL^𖳌ɂ܂B
+	/// </summary>
+	template <class Inner>
+	struct SourceSpanRecorder
+	{
+		SourceSpanRecorder(_Inout_ Inner& In_Inner, _Inout_ SourceLayout& Out_Layout, _In_ std::string_view In_Text)
+			: inner(In_Inner), layout(Out_Layout), text(In_Text)
+		{
+			layout.valid = true;
+		}
+
+		void OnMapStart() { Open(YAMLNode::Type::Map); inner.OnMapStart(); }
+		void OnSeqStart() { Open(YAMLNode::Type::Sequence); inner.OnSeqStart(); }
+		void OnMapEnd() { Close(); inner.OnMapEnd(); }
+		void OnSeqEnd() { Close(); inner.OnSeqEnd(); }
+		void OnKey(_In_ std::string_view In_Key)
+		{
+			key.assign(In_Key.data(), In_Key.size());
+			if (In_Key == "<<") layout.valid = false;
+			inner.OnKey(In_Key);
+		}
+		void OnScalar(_In_ std::string_view In_Value, _In_ YAMLNode::MultilineType In_MultilineType)
+		{
+			if (layout.valid)
 			{
-				// }bv̏ꍇ
-				if (node->type == YAMLNode::Type::Map)
-				{
-					auto& map = std::get<YAMLMap>(node->value);
-					auto itr = map.find(token);
-					if (itr == map.end())
-					{
-						// Ō̃g[NȂw肳ꂽ^Ő
-						if (next == std::string::npos)
-						{
-							switch (In_Type)
-							{
-							case YAMLNode::Type::Scalar:
-								map[token] = std::make_shared<YAMLNode>(YAMLScalar{}, In_MultilineType);
-								break;
-							case YAMLNode::Type::Map:
-								map[token] = std::make_shared<YAMLNode>(YAMLMap{});
-								break;
-							case YAMLNode::Type::Sequence:
-								map[token] = std::make_shared<YAMLNode>(YAMLSeq{});
-								break;
-							}
-						}
-						else
-						{
-							// rm[h͕KMapŐ
-							map[token] = std::make_shared<YAMLNode>(YAMLMap{});
-						}
-						itr = map.find(token);
-					}
-					node = itr->second.get();
-				}
-				// V[PX̏ꍇ
-				else if (node->type == YAMLNode::Type::Sequence)
-				{
-					if (!std::all_of(token.begin(), token.end(), ::isdigit))
-						throw std::invalid_argument("YAML: V[PXm[hɐlȊÕCfbNXw肪܂: " + token);
-					const size_t idx = std::stoul(token);
-					auto& seq = std::get<YAMLSeq>(node->value);
-					// ȂꍇMapŖ߂
-					while (seq.size() <= idx)
-					{
-						seq.push_back(std::make_shared<YAMLNode>(YAMLMap{}));
-					}
-					node = seq[idx].get();
-				}
-				else if (node->type == YAMLNode::Type::Scalar)
+				EnterChild();
+				SourceSpan span{ 0, In_Value.size(), false };
+				if (In_Value.data() >= text.data() && In_Value.data() + In_Value.size() <= text.data() + text.size())
 				{
-					// rm[hXJ[̏ꍇ͕s
-					if (next != std::string::npos)
-						throw std::logic_error("YAML: XJ[m[h̉Ɏqm[h𐶐邱Ƃ͂ł܂: " + token);
-
-					node->type = In_Type;
-					node->multilineType = In_MultilineType;
-					switch (In_Type)
-					{
-					case YAMLNode::Type::Scalar:
-						node->value = YAMLScalar{};
-						break;
-					case YAMLNode::Type::Map:
-						node->value = YAMLMap{};
-						break;
-					case YAMLNode::Type::Sequence:
-						node->value = YAMLSeq{};
-						break;
-					}
-					return;
+					span.offset = static_cast<size_t>(In_Value.data() - text.data());
+					span.inText = true;
 				}
 				else
 				{
-					throw std::logic_error("YAML: m̃m[h^ł");
+					span.offset = layout.detached.size();
+					layout.detached += In_Value;
 				}
+				if (!layout.scalars.emplace(path, span).second) layout.valid = false;
 			}
-			catch (const std::bad_variant_access& e)
-			{
-				std::cerr << "YAML: m[h^valuevariant^v܂: " << e.what() << std::endl;
-				return;
-			}
-			catch (const std::exception& e)
-			{
-				std::cerr << "YAML: O: " << e.what() << std::endl;
-				return;
-			}
-			catch (...)
-			{
-				std::cerr << "YAML: sȗO܂B" << std::endl;
-				return;
-			}
+			inner.OnScalar(In_Value, In_MultilineType);
+		}
+		void OnAnchor(_In_ std::string_view In_Name) { inner.OnAnchor(In_Name); }
+		void OnAlias(_In_ std::string_view In_Name)
+		{
+			layout.valid = false;
+			inner.OnAlias(In_Name);
+		}
 
-			if (next == std::string::npos) break;
-			// ̃g[N֐i
-			pos = next + 1;
+	private:
+		struct Frame
+		{
+			YAMLNode::Type type;
+			size_t count;		// ܂ł̎qvf̐
+			size_t pathSize;	// ̃ReĩpX̒
+		};
+
+		// ̎qvf̃pX path ɐݒ肷
+		void EnterChild()
+		{
+			if (frames.empty()) return;
+			Frame& frame = frames.back();
+			path.resize(frame.pathSize);
+			if (!path.empty()) path += '.';
+			if (frame.type == YAMLNode::Type::Map) path += key;
+			else path += std::to_string(frame.count);
+			++frame.count;
 		}
-		// ŏIm[ȟ^ƃ}`C^Cvݒ
-		node->type = In_Type;
-		node->multilineType = In_MultilineType;
-	}
+		void Open(_In_ const YAMLNode::Type& In_Type)
+		{
+			if (!layout.valid) return;
+			EnterChild();
+			frames.push_back({ In_Type, 0, path.size() });
+		}
+		void Close()
+		{
+			if (!layout.valid) return;
+			const Frame frame = frames.back();
+			frames.pop_back();
+			path.resize(frame.pathSize);
+			if (!layout.containers.emplace(path, SourceContainer{ frame.type, frame.count }).second) layout.valid = false;
+		}
+
+		Inner& inner;
+		SourceLayout& layout;
+		std::string_view text;		// l̈ʒůɂp[X̃eLXg
+		std::vector<Frame> frames;
+		std::string path;
+		std::string key;
+	};
 
 	/// <summary>
-	/// YAMLm[h̓eCfgtŕWo͂ɕ\܂B
+	/// p[XCxgm[hc[gݗĂnh[łBvLȏꍇ͐m[hvサ܂B
+	/// GCAX̓AJ[tm[ĥ܂܋LA}[WL[(&lt;&lt;)͎荞݌̒l̃m[hLėvfǉ܂B
 	/// </summary>
-	/// <param name="In_IndentDepth">õ͎CfgiXy[XjBftHg0łB</param>
-	inline void Print_YAML(_In_ const int& In_IndentDepth = 0) const noexcept
+	struct TreeBuilder
 	{
-		const std::string strIndent(In_IndentDepth, ' ');
+		explicit TreeBuilder(_In_ std::pmr::memory_resource* In_Resource) : resource(In_Resource), key(In_Resource), pending(In_Resource) {}
 
-		switch (m_YAMLData.type)
+		void OnMapStart()
 		{
-		case YAMLNode::Type::Scalar:
-			std::cout << strIndent << std::get<YAMLScalar>(m_YAMLData.value) << "\n";
-			break;
-		case YAMLNode::Type::Sequence:
-			for (const auto& seqNode : std::get<YAMLSeq>(m_YAMLData.value))
+			if (mergeDepth > 0) ++mergeDepth;
+			else Open(YAMLMap(resource));
+		}
+		void OnSeqStart()
+		{
+			// "<<: [*a, *b]" ̗vf͎荞݌ƂĈAV[PX͍Ȃ
+			if (mergeDepth > 0 || IsMergeKey())
 			{
-				switch (seqNode->type)
+				++mergeDepth;
+				return;
+			}
+			Open(YAMLSeq(resource));
+			if (denseThreshold > 0) denseCandidate = stack.back();
+		}
+		void OnMapEnd()
+		{
+			if (mergeDepth > 0) --mergeDepth;
+			else Close();
+		}
+		void OnSeqEnd()
+		{
+			if (mergeDepth > 0) --mergeDepth;
+			else Close();
+		}
+		void OnKey(_In_ std::string_view In_Key) { key.assign(In_Key.data(), In_Key.size()); }
+		void OnScalar(_In_ std::string_view In_Value, _In_ YAMLNode::MultilineType In_MultilineType)
+		{
+			if (mergeDepth > 0)
+			{
+				anchor.clear();
+				return;
+			}
+			if (denseCandidate)
+			{
+				if (anchor.empty() && In_MultilineType == YAMLNode::MultilineType::None && pending.Append(In_Value)) return;
+				ReleasePending();
+			}
+			const bool poolable = poolScalars && anchor.empty() && In_MultilineType == YAMLNode::MultilineType::None;
+			if (poolable)
+			{
+				const auto itr = scalarPool.find(In_Value);
+				if (itr != scalarPool.end())
 				{
-				case YAMLNode::Type::Scalar:
-					std::cout << strIndent << "- ";
-					Print_YAML(seqNode, 0);
-					break;
-				case YAMLNode::Type::Sequence:
-					std::cout << strIndent << "- \n";
-					Print_YAML(seqNode, In_IndentDepth + 2);
-					break;
-				case YAMLNode::Type::Map:
-					std::cout << strIndent << "- \n";
-					for (const auto& kv : std::get<YAMLMap>(seqNode->value))
-					{
-						std::cout << strIndent << "  " << kv.first << ":";
-						if (kv.second->type == YAMLNode::Type::Scalar)
-						{
-							std::cout << " " << std::get<YAMLScalar>(kv.second->value) << "\n";
-						}
-						else
-						{
-							std::cout << "\n";
-							Print_YAML(kv.second, In_IndentDepth + 4);
-						}
-					}
-					break;
-				default:
-					break;
+					Attach(itr->second);
+					return;
 				}
 			}
-			break;
-		case YAMLNode::Type::Map:
-			for (const auto& keyValue : std::get<YAMLMap>(m_YAMLData.value))
+			auto node = AllocateNode(resource, YAMLScalar(In_Value, resource), In_MultilineType);
+			YAMLPARSER_STATS(if (stats) CountNode(*stats, *node));
+			// ƍp̃L[̓m[hg̕QƂ(gݗĒ͏ȂߗL)
+			if (poolable) scalarPool.emplace(std::get<YAMLScalar>(node->value), node);
+			Register(node);
+			Attach(std::move(node));
+		}
+		void OnAnchor(_In_ std::string_view In_Name) { anchor.assign(In_Name.data(), In_Name.size()); }
+		void OnAlias(_In_ std::string_view In_Name)
+		{
+			anchor.clear();
+			if (mergeDepth > 1) return;
+			if (denseCandidate) ReleasePending();
+
+			const bool merge = mergeDepth > 0 || IsMergeKey();
+			const auto itr = anchors.find(std::string(In_Name));
+			// gݗĒ̃ReiwGCAX͏zQƂɂȂ邽߉Ȃ
+			if (itr == anchors.end() || std::find(stack.begin(), stack.end(), itr->second.get()) != stack.end())
+			{
+				// eȂ悤AĂƂ̕ƂĎc
+				Warn(In_Name, "GCAXł܂: *" + std::string(In_Name));
+				if (mergeDepth > 0) return;
+				YAMLScalar text(resource);
+				text += '*';
+				text += In_Name;
+				Attach(AllocateNode(resource, std::move(text)));
+				return;
+			}
+			if (merge) Merge(itr->second, In_Name);
+			else Attach(itr->second);
+		}
+
+		std::pmr::memory_resource* resource;	// m[h̊mۂɎg\[X
+		std::shared_ptr<YAMLNode> root;			// ŏʂ̃m[h
+		std::vector<YAMLNode*> stack;			// gݗĒ̃Rei
+		YAMLString key;							// OɒʒmꂽL[
+		size_t denseThreshold = 0;				// ̗vfȏ̐l̃V[PX𐔒lzɂ(0 ͖)
+		bool poolScalars = false;				// l̃XJ[̃m[hL
+		AnchorNameTable anchorNames;			// AJ[tm[hƂ̖O
+		MergeSourceTable mergeSources;			// }[WL[ŗvf荞񂾃}bvƎ荞݌
+		YAMLLines* lines = nullptr;				// ̈ʒuL^邽߂̓ǂݍݒ̍s(nullptr ̏ꍇ̓Oɂo͂)
+#if defined(YAMLPARSER_ENABLE_STATS)
+		YAMLStats* stats = nullptr;				// v̎W
+#endif
+
+	private:
+		template <class Container>
+		void Open(_In_ Container&& In_Container)
+		{
+			if (denseCandidate) ReleasePending();
+			auto node = AllocateNode(resource, std::move(In_Container));
+			YAMLNode* container = node.get();
+			Register(node);
+			Attach(std::move(node));
+			stack.push_back(container);
+		}
+
+		// Rei͗vfĂvシ(mۗʂm肷邽)
+		void Close()
+		{
+			if (denseCandidate)
 			{
-				std::cout << strIndent << keyValue.first << ":";
-				if (keyValue.second->type == YAMLNode::Type::Scalar)
+				if (pending.size() >= denseThreshold)
 				{
-					std::cout << " " << std::get<YAMLScalar>(keyValue.second->value) << "\n";
+					denseCandidate->value = std::move(pending);
+					denseCandidate->type = YAMLNode::Type::NumericArray;
+					pending = YAMLNumericArray(resource);
+					denseCandidate = nullptr;
 				}
 				else
 				{
-					std::cout << "\n";
-					Print_YAML(keyValue.second, In_IndentDepth + 2);
+					ReleasePending();
 				}
 			}
-			break;
-		default:
-			break;
+			YAMLPARSER_STATS(if (stats) CountNode(*stats, *stack.back()));
+			stack.pop_back();
 		}
-	}
 
-private:
+		// lzɂłȂȂV[PXցAۗĂvfXJ[m[hƂĒǉ
+		void ReleasePending()
+		{
+			auto& seq = std::get<YAMLSeq>(denseCandidate->value);
+			denseCandidate = nullptr;
+			seq.reserve(pending.size());
+			char buffer[YAMLNumericArray::FormatBufferSize];
+			for (size_t i = 0; i < pending.size(); ++i)
+			{
+				auto node = AllocateNode(resource, YAMLScalar(pending.Format(i, buffer), resource));
+				YAMLPARSER_STATS(if (stats) CountNode(*stats, *node));
+				seq.push_back(std::move(node));
+			}
+			pending.ints.clear();
+			pending.doubles.clear();
+		}
 
-	// YAMLf[^ێ郁o[ϐ
-	YAMLNode m_YAMLData = YAMLNode(YAMLMap{});
+		// ̒l}[WL[̒l
+		bool IsMergeKey() const
+		{
+			return !stack.empty() && stack.back()->type == YAMLNode::Type::Map && key == "<<";
+		}
+
+		// ۗ̃AJ[𐶐m[hɕtBOĂюgꂽꍇ́Aȍ~̃GCAX͐Vm[hw
+		void Register(_In_ const std::shared_ptr<YAMLNode>& In_Node)
+		{
+			if (anchor.empty()) return;
+			anchorNames[In_Node.get()] = anchor;
+			anchors[std::move(anchor)] = In_Node;
+			anchor.clear();
+		}
+
+		// 荞݌̃}bv̗vf̂A܂ȂL[ǉBꂽL[͑OǂɏĂĂD悳
+		void Merge(_In_ const std::shared_ptr<YAMLNode>& In_Source, _In_ std::string_view In_Name)
+		{
+			if (In_Source->type != YAMLNode::Type::Map)
+			{
+				Warn(In_Name, "}[WL[̒l}bvł͂܂: " + std::string(key));
+				return;
+			}
+			YAMLNode& target = *stack.back();
+			auto& map = std::get<YAMLMap>(target.value);
+			for (const auto& keyValue : std::get<YAMLMap>(In_Source->value))
+				map.try_emplace(keyValue.first, keyValue.second);
+			// [g ParseYAML Ńp[T[ֈړ邽 nullptr ŕ\
+			mergeSources[stack.size() == 1 ? nullptr : &target].push_back(In_Source);
+		}
+
+		// Oɏo͂Aǂݍݒ̃eLXg In_At ̈ʒuƂƂɋL^
+		void Warn(_In_ std::string_view In_At, _In_ const std::string& In_Message)
+		{
+			Log(LogLevel::Warning, In_Message);
+			if (lines) ReportInLastLine(*lines, LogLevel::Warning, In_At, In_Message);
+		}
+
+		void Attach(_In_ std::shared_ptr<YAMLNode> In_Node)
+		{
+			if (stack.empty())
+			{
+				root = std::move(In_Node);
+				return;
+			}
+			YAMLNode& parent = *stack.back();
+			if (parent.type == YAMLNode::Type::Map)
+				std::get<YAMLMap>(parent.value).insert_or_assign(key, std::move(In_Node));
+			else
+				std::get<YAMLSeq>(parent.value).push_back(std::move(In_Node));
+		}
+
+		YAMLNode* denseCandidate = nullptr;		// lzɂł邩蒆̃V[PX(gݗĒ̍ł̃Rei)
+		YAMLNumericArray pending;				// denseCandidate ɕۗĂvf
+		std::string anchor;						// ɐm[hɕtAJ[
+		std::unordered_map<std::string, std::shared_ptr<YAMLNode>> anchors;	// AJ[Ōɂ̖Otm[h
+		size_t mergeDepth = 0;					// }[WL[̒l̃V[PX̃lXg
+		std::unordered_map<std::string_view, std::shared_ptr<YAMLNode>> scalarPool;	// l狤LXJ[m[h
+	};
+
+	// gݗďIc[YAMLf[^Ƃĕێ܂B
+	void AdoptTree(_Inout_ TreeBuilder& In_Builder, _In_ SourceLayout&& In_Layout)
+	{
+		m_SourceLayout = std::move(In_Layout);
+		m_YAMLData = std::move(*In_Builder.root);
+		m_AnchorNames = std::move(In_Builder.anchorNames);
+		m_MergeSources = std::move(In_Builder.mergeSources);
+		if (m_UsePathIndex) RebuildPathIndex();
+	}
 
 	/// <summary>
-	/// YAMLm[hWo͂ɃCfgtōċAIɕ\܂B
+	/// eLXgsŕ܂Bes̓eLXgQƂ邽߁AeLXg͍sgI܂ŕێĂB
+	/// ̉šƁAϊɕtꂽI[͍sƂĈ܂B
 	/// </summary>
-	/// <param name="In_Node">\YAMLm[hւ̋L|C^B</param>
-	/// <param name="In_IndentDepth">݂̃CfgiXy[XjBftHg0B</param>
-	static void Print_YAML(_In_ const std::shared_ptr<YAMLNode>& In_Node, _In_ const int& In_IndentDepth = 0)
+	static void SplitLines(_In_ std::string_view In_Text, _Out_ std::vector<std::string_view>& Out_Lines)
 	{
-		if (!In_Node) return;
-		const std::string strIndent(In_IndentDepth, ' ');
+		if (!In_Text.empty() && In_Text.back() == '\0') In_Text.remove_suffix(1);
+		Out_Lines.clear();
+		Out_Lines.reserve(static_cast<size_t>(std::count(In_Text.begin(), In_Text.end(), '\n')) + 1);
+		size_t pos = 0;
+		while (pos < In_Text.size())
+		{
+			const size_t end = (std::min)(In_Text.find('\n', pos), In_Text.size());
+			Out_Lines.push_back(In_Text.substr(pos, end - pos));
+			pos = end + 1;
+		}
+	}
 
-		switch (In_Node->type)
+	static inline size_t IndentCounter(_In_ std::string_view In_Line) noexcept
+	{
+		size_t IndentCnt = 0;
+		while (IndentCnt < In_Line.size() &&
+			(In_Line[IndentCnt] == ' ' || In_Line[IndentCnt] == '\t'))
+			++IndentCnt;
+		return IndentCnt;
+	}
+
+	static inline std::string_view TrimLeftWhitespace(_In_ std::string_view In_str) noexcept
+	{
+		const size_t idxCnt = In_str.find_first_not_of(" \t\n\r\f\v");
+		return (idxCnt == std::string_view::npos) ? std::string_view() : In_str.substr(idxCnt);
+	}
+
+	static inline std::string Convert_UTF8_To_ShiftJIS(_In_ const std::string_view& In_Source)
+	{
+		const char* text = In_Source.data();
+		int size_needed = MultiByteToWideChar(CP_UTF8, 0, reinterpret_cast<const char*>(text), -1, NULL, 0);
+		std::wstring wideText(size_needed, 0);
+		MultiByteToWideChar(CP_UTF8, 0, reinterpret_cast<const char*>(text), -1, &wideText[0], size_needed);
+
+		size_needed = WideCharToMultiByte(932, 0, wideText.c_str(), -1, NULL, 0, NULL, NULL);
+		std::string shiftJISText(size_needed, 0);
+		WideCharToMultiByte(932, 0, wideText.c_str(), -1, &shiftJISText[0], size_needed, NULL, NULL);
+
+		return shiftJISText;
+	}
+
+	static inline std::string Convert_ShiftJIS_To_UTF8(_In_ std::string_view In_Source)
+	{
+		if (In_Source.empty()) return std::string();
+		const int sourceSize = static_cast<int>(In_Source.size());
+		int size_needed = MultiByteToWideChar(932, 0, In_Source.data(), sourceSize, NULL, 0);
+		std::wstring wideText(size_needed, 0);
+		MultiByteToWideChar(932, 0, In_Source.data(), sourceSize, &wideText[0], size_needed);
+
+		size_needed = WideCharToMultiByte(CP_UTF8, 0, wideText.c_str(), static_cast<int>(wideText.size()), NULL, 0, NULL, NULL);
+		std::string utf8Text(size_needed, 0);
+		WideCharToMultiByte(CP_UTF8, 0, wideText.c_str(), static_cast<int>(wideText.size()), &utf8Text[0], size_needed, NULL, NULL);
+
+		return utf8Text;
+	}
+
+	// sXJ[ In_YAMLLines.scratch ɑgݗĂĕԂ܂B߂ľ͎Ăяo܂ŗLłB
+	static inline std::string_view ParseMultilineScalar(_Inout_ YAMLLines& In_YAMLLines, _In_ const size_t& In_BaseIndent)
+	{
+		const size_t firstLine = In_YAMLLines.currentPos;
+		size_t minIndent = std::string::npos;
+
+		while (!In_YAMLLines.eof())
 		{
-		case YAMLNode::Type::Scalar:
-			std::cout << strIndent << std::get<YAMLScalar>(In_Node->value) << "\n";
-			break;
-		case YAMLNode::Type::Sequence:
-			for (const auto& seqNode : std::get<YAMLSeq>(In_Node->value))
-			{
-				switch (seqNode->type)
-				{
-				case YAMLNode::Type::Scalar:
-					std::cout << strIndent << "- ";
-					Print_YAML(seqNode, 0);
-					break;
-				case YAMLNode::Type::Sequence:
-					std::cout << strIndent << "- \n";
-					Print_YAML(seqNode, In_IndentDepth + 2);
-					break;
-				case YAMLNode::Type::Map:
-					std::cout << strIndent << "- \n";
-					for (const auto& kv : std::get<YAMLMap>(seqNode->value))
-					{
-						std::cout << strIndent << "  " << kv.first << ":";
-						if (kv.second->type == YAMLNode::Type::Scalar)
-						{
-							std::cout << " " << std::get<YAMLScalar>(kv.second->value) << "\n";
-						}
-						else
-						{
-							std::cout << "\n";
-							Print_YAML(kv.second, In_IndentDepth + 4);
-						}
-					}
-					break;
-				default:
-					break;
-				}
-			}
-			break;
-		case YAMLNode::Type::Map:
-			for (const auto& keyValue : std::get<YAMLMap>(In_Node->value))
+			const std::string_view line = In_YAMLLines.peek();
+			if (line.empty())
 			{
-				std::cout << strIndent << keyValue.first << ":";
-				if (keyValue.second->type == YAMLNode::Type::Scalar)
-				{
-					std::cout << " " << std::get<YAMLScalar>(keyValue.second->value) << "\n";
-				}
-				else
-				{
-					std::cout << "\n";
-					Print_YAML(keyValue.second, In_IndentDepth + 2);
-				}
+				In_YAMLLines.next();
+				continue;
 			}
-			break;
-		default:
-			break;
+			const size_t indent = IndentCounter(line);
+			if (indent < In_BaseIndent) break;
+
+			if (line.find_first_not_of(" \t") != std::string::npos)
+#undef min
+				minIndent = std::min(minIndent, indent);
+
+			In_YAMLLines.next();
 		}
+
+		if (minIndent == std::string::npos) minIndent = In_BaseIndent;
+
+		// ǂݐi߂ŝ܂܌(sƂ̈ꎞ͍Ȃ)
+		std::string& result = In_YAMLLines.scratch;
+		result.clear();
+		for (size_t i = firstLine; i < In_YAMLLines.currentPos; ++i)
+		{
+			std::string_view lineContent = In_YAMLLines.lines[i];
+			if (lineContent.size() >= minIndent)
+				lineContent.remove_prefix(minIndent);
+			while (!lineContent.empty() && (lineContent.back() == '\r'))
+				lineContent.remove_suffix(1);
+
+			result += lineContent;
+			if (i + 1 < In_YAMLLines.currentPos) result += "\n";
+		}
+
+		return result;
 	}
 
-	static void WriteYAMLNode(std::ostream& Out_OStream, _In_ const YAMLNode& In_YAMLNode, _In_ const int& In_IndentDepth)
+	// t[`̃RNV([...] ܂ {...})ƂĎn܂lǂ𔻒肵܂B
+	static inline bool IsFlowStart(_In_ std::string_view In_Value) noexcept
 	{
-		const std::string strIndent(In_IndentDepth, ' ');
-		switch (In_YAMLNode.type)
+		return !In_Value.empty() && (In_Value[0] == '[' || In_Value[0] == '{');
+	}
+
+	static inline bool IsFlowSpace(_In_ const char& In_Char) noexcept
+	{
+		return In_Char == ' ' || In_Char == '\t' || In_Char == '\r' || In_Char == '\n';
+	}
+
+	// t[`̊ʂ̑ΉǐՂ鑖ԂłBspꍇ͑ĊJ܂B
+	struct FlowScanState
+	{
+		size_t pos = 0;				// ɒׂʒu
+		size_t depth = 0;			// JĂ銇ʂ̐
+		char quote = 0;				// p̓ɂꍇ͂̈p
+		bool tokenStart = true;		// pŎn܂luʒuǂ
+		bool comment = false;		// s܂ł̃Rg̓ǂ
+	};
+
+	// ŏ̊ʂꍇ true ԂAIn_State.pos ʂ̒ɍ킹܂BpƃRg̊ʂ͐܂B
+	static inline bool ScanFlow(_In_ std::string_view In_Text, _Inout_ FlowScanState& In_State) noexcept
+	{
+		for (size_t& i = In_State.pos; i < In_Text.size(); ++i)
 		{
-		case YAMLNode::Type::Scalar:
-			WriteScalar(Out_OStream, std::get<YAMLScalar>(In_YAMLNode.value),
-				In_YAMLNode.multilineType, In_IndentDepth);
-			break;
-		case YAMLNode::Type::Sequence:
-			for (const auto& seqNode : std::get<YAMLSeq>(In_YAMLNode.value))
+			const char c = In_Text[i];
+			if (In_State.comment)
 			{
-				Out_OStream << strIndent << "-";
-				if (seqNode->type == YAMLNode::Type::Scalar)
-				{
-					WriteScalar(Out_OStream, std::get<YAMLScalar>(seqNode->value),
-						seqNode->multilineType, In_IndentDepth + 2);
-				}
-				else
-				{
-					Out_OStream << "\n";
-					WriteYAMLNode(Out_OStream, *seqNode, In_IndentDepth + 2);
-				}
+				if (c == '\n') In_State.comment = false;
+				continue;
 			}
-			break;
-		case YAMLNode::Type::Map:
-			for (const auto& keyValue : std::get<YAMLMap>(In_YAMLNode.value))
+			if (In_State.quote)
 			{
-				Out_OStream << strIndent << keyValue.first << ":";
-				if (keyValue.second->type == YAMLNode::Type::Scalar)
-				{
-					WriteScalar(Out_OStream, std::get<YAMLScalar>(keyValue.second->value),
-						keyValue.second->multilineType, In_IndentDepth + 2);
-				}
-				else
+				if (c == '\\' && In_State.quote == '"' && i + 1 < In_Text.size()) ++i;
+				else if (c == In_State.quote) In_State.quote = 0;
+				continue;
+			}
+			switch (c)
+			{
+			case '[':
+			case '{':
+				++In_State.depth;
+				In_State.tokenStart = true;
+				break;
+			case ']':
+			case '}':
+				if (--In_State.depth == 0)
 				{
-					Out_OStream << "\n";
-					WriteYAMLNode(Out_OStream, *keyValue.second, In_IndentDepth + 2);
+					++i;
+					return true;
 				}
+				In_State.tokenStart = false;
+				break;
+			case ',':
+			case ':':
+				In_State.tokenStart = true;
+				break;
+			case '"':
+			case '\'':
+				if (In_State.tokenStart) In_State.quote = c;
+				In_State.tokenStart = false;
+				break;
+			case '#':
+				if (i > 0 && IsFlowSpace(In_Text[i - 1])) In_State.comment = true;
+				else In_State.tokenStart = false;
+				break;
+			default:
+				if (!IsFlowSpace(c)) In_State.tokenStart = false;
+				break;
 			}
-			break;
-		default:
-			break;
 		}
-
-		// Cfg[x2ȉ̏ꍇ(ԑ傫ȍڂ)
-		if (In_IndentDepth <= 2) Out_OStream << "\n"; // Ōɉsǉ
+		return false;
 	}
 
-	static inline void WriteScalar(std::ostream& Out_OStream, _In_ const std::string& In_Scalar,
-		_In_ const YAMLNode::MultilineType& In_MultilineType, _In_ const int& In_IndentDepth)
+	// 󔒂ƃRgǂݔ΂ʒuԂ܂B
+	static inline size_t SkipFlowSpace(_In_ std::string_view In_Text, _In_ size_t In_Pos) noexcept
 	{
-		const std::string strIndent(In_IndentDepth, ' ');
-		if (In_MultilineType == YAMLNode::MultilineType::Literal)
+		while (In_Pos < In_Text.size())
 		{
-			Out_OStream << " |\n";
-			std::istringstream iss(In_Scalar);
-			std::string line;
-			while (std::getline(iss, line))
-				Out_OStream << strIndent << line << "\n";
+			if (IsFlowSpace(In_Text[In_Pos])) ++In_Pos;
+			else if (In_Text[In_Pos] == '#' && In_Pos > 0 && IsFlowSpace(In_Text[In_Pos - 1]))
+				In_Pos = (std::min)(In_Text.find('\n', In_Pos), In_Text.size());
+			else break;
 		}
-		else if (In_MultilineType == YAMLNode::MultilineType::Folded)
+		return In_Pos;
+	}
+
+	// t[`̗vf̃XJ[(pt܂)̏I[Ԃ܂BL[̏ꍇ ':' ł؂܂B
+	static inline size_t ScanFlowScalar(_In_ std::string_view In_Text, _In_ size_t In_Pos, _In_ const bool& In_IsKey) noexcept
+	{
+		if (In_Pos < In_Text.size() && (In_Text[In_Pos] == '"' || In_Text[In_Pos] == '\''))
 		{
-			Out_OStream << " >\n";
-			std::istringstream iss(In_Scalar);
-			std::string line;
-			while (std::getline(iss, line))
-				Out_OStream << strIndent << line << "\n";
+			const char quote = In_Text[In_Pos++];
+			while (In_Pos < In_Text.size() && In_Text[In_Pos] != quote)
+				In_Pos += (In_Text[In_Pos] == '\\' && quote == '"') ? 2 : 1;
+			In_Pos = (std::min)(In_Pos + 1, In_Text.size());
 		}
-		else
+		for (; In_Pos < In_Text.size(); ++In_Pos)
 		{
-			Out_OStream << " " << In_Scalar << "\n";
+			const char c = In_Text[In_Pos];
+			if (c == ',' || c == '[' || c == ']' || c == '{' || c == '}' || (In_IsKey && c == ':')) break;
+			if (c == '#' && IsFlowSpace(In_Text[In_Pos - 1])) break;
 		}
+		return In_Pos;
 	}
 
-	inline const YAMLScalar* FindScalarByPath(_In_ const std::string& In_KeyPath) const
+	// Ő󔒂t[`̃XJ[؂o܂B
+	static inline std::string_view FlowToken(_In_ std::string_view In_Text, _In_ const size_t& In_Begin, _In_ const size_t& In_End) noexcept
 	{
-		const YAMLNode* node = &m_YAMLData;
-		size_t pos = 0, next;
-		while (pos < In_KeyPath.size())
+		std::string_view token = In_Text.substr(In_Begin, In_End - In_Begin);
+		while (!token.empty() && IsFlowSpace(token.back())) token.remove_suffix(1);
+		return token;
+	}
+
+	// AJ[EGCAX̏I[(󔒂܂̓t[`̋؂)Ԃ܂B
+	static inline size_t ScanAnchorName(_In_ std::string_view In_Text, _In_ size_t In_Pos) noexcept
+	{
+		while (In_Pos < In_Text.size())
 		{
-			next = In_KeyPath.find('.', pos);
-			const std::string token = In_KeyPath.substr(pos, next == std::string::npos ? std::string::npos : next - pos);
+			const char c = In_Text[In_Pos];
+			if (IsFlowSpace(c) || c == ',' || c == '[' || c == ']' || c == '{' || c == '}') break;
+			++In_Pos;
+		}
+		return In_Pos;
+	}
 
-			if (node->type == YAMLNode::Type::Map)
-			{
-				const auto& map = std::get<YAMLMap>(node->value);
-				auto itr = map.find(token);
-				if (itr == map.end()) return nullptr;
-				node = itr->second.get();
-			}
-			else if (node->type == YAMLNode::Type::Sequence)
-			{
-				if (!std::all_of(token.begin(), token.end(), ::isdigit)) return nullptr;
-				const size_t idx = std::stoul(token);
-				const auto& seq = std::get<YAMLSeq>(node->value);
-				if (idx >= seq.size()) return nullptr;
-				node = seq[idx].get();
-			}
-			else
+	/// <summary>
+	/// p[Xł؂AƍsԍOɏo͂܂B
+	/// </summary>
+	static void FailParse(_Inout_ YAMLLines& In_YAMLLines, _In_ const std::string& In_Message)
+	{
+		if (In_YAMLLines.failed) return;
+		In_YAMLLines.failed = true;
+		Log(LogLevel::Error, In_Message + "(" + std::to_string((std::min)(In_YAMLLines.currentPos + 1, In_YAMLLines.lines.size())) + "sڕt)");
+		if (In_YAMLLines.lines.empty()) return;
+		const size_t lineIndex = (std::min)(In_YAMLLines.currentPos, In_YAMLLines.lines.size() - 1);
+		Report(In_YAMLLines, LogLevel::Error, lineIndex, IndentCounter(In_YAMLLines.lines[lineIndex]), In_Message);
+	}
+
+	/// <summary>
+	/// s̈ʒuƂƂɋL^܂BOɂ͏o͂܂B
+	/// ʒu̓p[XĂeLXĝ̂ŁAMapDiagnosticsToSource œǂݍ񂾃t@C̈ʒuɒu܂B
+	/// </summary>
+	/// <param name="In_LineIndex">s̔ԍ(0)B</param>
+	/// <param name="In_Column">s̃oCgʒu(0)B</param>
+	static void Report(_Inout_ YAMLLines& In_YAMLLines, _In_ const LogLevel& In_Level, _In_ const size_t& In_LineIndex,
+		_In_ const size_t& In_Column, _In_ std::string_view In_Message)
+	{
+		if (!In_YAMLLines.diagnostics) return;
+		const std::string_view line = In_YAMLLines.lines[In_LineIndex];
+		const size_t offset = static_cast<size_t>(line.data() - In_YAMLLines.lines.front().data()) + In_Column;
+		In_YAMLLines.diagnostics->push_back(YAMLDiagnostic{ In_Level, In_LineIndex + 1, In_Column + 1, offset, std::string(In_Message) });
+	}
+
+	// ݂̍sǂݔ΂ƂL^܂Bʒu͍s̍ŏ̋󔒂łȂłBCfgꂽRgs͋L^܂B
+	static void ReportSkippedLine(_Inout_ YAMLLines& In_YAMLLines, _In_ std::string_view In_Message)
+	{
+		if (!In_YAMLLines.diagnostics) return;
+		const std::string_view trimmed = TrimLeftWhitespace(In_YAMLLines.peek());
+		if (!trimmed.empty() && trimmed[0] == '#') return;
+		Report(In_YAMLLines, LogLevel::Warning, In_YAMLLines.currentPos, IndentCounter(In_YAMLLines.peek()), In_Message);
+	}
+
+	// L[̌ɏꂽlA̍sn܂Cfg̐[ubNɒuēǂݎ̂ĂꂽƂL^܂B
+	// O̍sǂݏIԂŌĂяo܂Bʒu͂̍s̒l̐擪łBlȂRgubNXJ[̎wq̏ꍇ͋L^܂B
+	static void ReportDiscardedValue(_Inout_ YAMLLines& In_YAMLLines, _In_ std::string_view In_Value)
+	{
+		if (In_Value.empty() || In_Value[0] == '#' || In_Value[0] == '|' || In_Value[0] == '>') return;
+		ReportInLastLine(In_YAMLLines, LogLevel::Warning, In_Value, "l̎̍sɃCfg̐[ubN邽߁AL[̌̒lǂݎ̂Ă܂");
+	}
+
+	// OɓǂݏIśAIn_At wʒu̖L^܂B
+	// In_At ̍s̊O(s̃t[`pobt@Ȃ)wꍇ́As̍ŏ̋󔒂łȂ̈ʒuƂ܂B
+	static void ReportInLastLine(_Inout_ YAMLLines& In_YAMLLines, _In_ const LogLevel& In_Level, _In_ std::string_view In_At, _In_ std::string_view In_Message)
+	{
+		if (!In_YAMLLines.diagnostics || In_YAMLLines.currentPos == 0) return;
+		const size_t lineIndex = In_YAMLLines.currentPos - 1;
+		const std::string_view line = In_YAMLLines.lines[lineIndex];
+		const bool inLine = In_At.data() >= line.data() && In_At.data() < line.data() + line.size();
+		Report(In_YAMLLines, In_Level, lineIndex, inLine ? static_cast<size_t>(In_At.data() - line.data()) : IndentCounter(line), In_Message);
+	}
+
+	/// <summary>
+	/// In_Start Ԗڈȍ~̖̈ʒuAp[XeLXg(Shift_JIS)̈ʒuǂݍ񂾃t@C(UTF-8)̈ʒuɒuAʒȕɕׂ܂B
+	/// ̂͂łĂ΂邽߁ÅԂɂ镔ϊĒ𐔂܂B
+	/// </summary>
+	static void MapDiagnosticsToSource(_In_ std::string_view In_Text, _Inout_ std::vector<YAMLDiagnostic>& In_Diagnostics, _In_ const size_t& In_Start)
+	{
+		const auto first = In_Diagnostics.begin() + static_cast<std::ptrdiff_t>(In_Start);
+		std::stable_sort(first, In_Diagnostics.end(), [](const YAMLDiagnostic& In_Left, const YAMLDiagnostic& In_Right) { return In_Left.offset < In_Right.offset; });
+		if (std::all_of(In_Text.begin(), In_Text.end(), [](const char In_Char) { return static_cast<unsigned char>(In_Char) < 0x80; })) return;
+
+		size_t from = 0, mapped = 0;
+		size_t lineStart = std::string_view::npos, lineMapped = 0;
+		for (auto itr = first; itr != In_Diagnostics.end(); ++itr)
+		{
+			const size_t start = itr->offset - (itr->column - 1);
+			if (start != lineStart)
 			{
-				return nullptr;
+				mapped += Convert_ShiftJIS_To_UTF8(In_Text.substr(from, start - from)).size();
+				from = lineStart = start;
+				lineMapped = mapped;
 			}
-			if (next == std::string::npos) break;
-			pos = next + 1;
+			mapped += Convert_ShiftJIS_To_UTF8(In_Text.substr(from, itr->offset - from)).size();
+			from = itr->offset;
+			itr->column = mapped - lineMapped + 1;
+			itr->offset = mapped;
 		}
-		if (node->type == YAMLNode::Type::Scalar)
+	}
+
+	// ~vm߂Ԋu(s)
+	static constexpr size_t ControlInterval = 4096;
+
+	static inline bool IsParseCancelled(_In_opt_ const YAMLParseControl* In_Control) noexcept
+	{
+		return In_Control && In_Control->cancel && In_Control->cancel->load(std::memory_order_relaxed);
+	}
+
+	/// <summary>
+	/// iʒmA~vĂ΃p[Xł؂܂B
+	/// </summary>
+	/// <returns>p[X𑱂ꍇ true Ԃ܂B</returns>
+	static bool PollControl(_Inout_ YAMLLines& In_YAMLLines)
+	{
+		In_YAMLLines.nextControlPos = In_YAMLLines.currentPos + ControlInterval;
+		if (IsParseCancelled(In_YAMLLines.control))
 		{
-			return &std::get<YAMLScalar>(node->value);
+			In_YAMLLines.failed = true;
+			Log(LogLevel::Info, "p[X𒆎~܂B");
+			return false;
 		}
-		return nullptr;
+		if (In_YAMLLines.control->onProgress && !In_YAMLLines.lines.empty())
+		{
+			const std::string_view first = In_YAMLLines.lines.front();
+			const std::string_view last = In_YAMLLines.lines.back();
+			const size_t total = static_cast<size_t>(last.data() + last.size() - first.data());
+			const size_t done = In_YAMLLines.eof() ? total : static_cast<size_t>(In_YAMLLines.peek().data() - first.data());
+			In_YAMLLines.control->onProgress({ YAMLProgress::Stage::Parse, done, total });
+		}
+		return true;
 	}
 
-	/// YAMLt@C̍sǗÄ݂ʒuǐՂ܂B
-	struct YAMLLines
+	// m[h1A𒴂ꍇ̓p[Xł؂܂B
+	static bool AddParsedNode(_Inout_ YAMLLines& In_YAMLLines)
 	{
-		std::vector<std::string> lines;	// YAMLt@C̍si[xN^[
-		size_t currentPos = 0;			// ݂̍sʒuǐՂCfbNX
+		if (In_YAMLLines.failed) return false;
+		++In_YAMLLines.nodes;
+		if (In_YAMLLines.limits.maxNodes == 0 || In_YAMLLines.nodes <= In_YAMLLines.limits.maxNodes) return true;
+		FailParse(In_YAMLLines, "m[h̐(" + std::to_string(In_YAMLLines.limits.maxNodes) + ")𒴂܂");
+		return false;
+	}
 
-		// ݂̈ʒus𒴂Ă邩ǂmF܂B
-		inline bool eof() const noexcept { return currentPos >= lines.size(); }
-		// ݂̍sʒu擾܂B
-		inline void next() noexcept { ++currentPos; }
-		// ݂̍s擾܂B
-		inline const std::string& peek() const { return lines[currentPos]; }
-	};
+	// XJ[܂̓L[̒m߁A𒴂ꍇ̓p[Xł؂܂B
+	static bool CheckScalarLength(_Inout_ YAMLLines& In_YAMLLines, _In_ const size_t& In_Length)
+	{
+		if (In_YAMLLines.failed) return false;
+		if (In_YAMLLines.limits.maxScalarLength == 0 || In_Length <= In_YAMLLines.limits.maxScalarLength) return true;
+		FailParse(In_YAMLLines, "XJ[̒(" + std::to_string(In_YAMLLines.limits.maxScalarLength) + "oCg)𒴂܂");
+		return false;
+	}
 
-	static inline size_t IndentCounter(_In_ const std::string& In_Line) noexcept
+	// ReiɓOɐ[ƃm[hm߂܂Bꍇ LeaveContainer Ƒ΂ɂ܂B
+	static bool EnterContainer(_Inout_ YAMLLines& In_YAMLLines)
 	{
-		size_t IndentCnt = 0;
-		while (IndentCnt < In_Line.size() &&
-			(In_Line[IndentCnt] == ' ' || In_Line[IndentCnt] == '\t'))
-			++IndentCnt;
-		return IndentCnt;
+		if (!AddParsedNode(In_YAMLLines)) return false;
+		if (In_YAMLLines.limits.maxDepth != 0 && In_YAMLLines.depth >= In_YAMLLines.limits.maxDepth)
+		{
+			FailParse(In_YAMLLines, "lXg̐[(" + std::to_string(In_YAMLLines.limits.maxDepth) + ")𒴂܂");
+			return false;
+		}
+		++In_YAMLLines.depth;
+		YAMLPARSER_STATS(if (In_YAMLLines.stats && In_YAMLLines.depth > In_YAMLLines.stats->maxDepth) In_YAMLLines.stats->maxDepth = In_YAMLLines.depth);
+		return true;
 	}
+	static inline void LeaveContainer(_Inout_ YAMLLines& In_YAMLLines) noexcept { --In_YAMLLines.depth; }
 
-	static inline std::string TrimLeftWhitespace(_In_ const std::string& In_str) noexcept
+	template <class Handler>
+	static void EmitKey(_Inout_ YAMLLines& In_YAMLLines, _Inout_ Handler& In_Handler, _In_ std::string_view In_Key)
 	{
-		if (In_str.empty()) return In_str;
-		const size_t idxCnt = In_str.find_first_not_of(" \t\n\r\f\v");
-		return (idxCnt == std::string::npos) ? "" : In_str.substr(idxCnt);
+		if (CheckScalarLength(In_YAMLLines, In_Key.size())) In_Handler.OnKey(In_Key);
 	}
 
-	static inline std::string Convert_UTF8_To_ShiftJIS(_In_ const std::string_view& In_Source)
+	template <class Handler>
+	static void EmitScalar(_Inout_ YAMLLines& In_YAMLLines, _Inout_ Handler& In_Handler, _In_ std::string_view In_Value,
+		_In_ const YAMLNode::MultilineType& In_MultilineType = YAMLNode::MultilineType::None)
 	{
-		const char* text = In_Source.data();
-		int size_needed = MultiByteToWideChar(CP_UTF8, 0, reinterpret_cast<const char*>(text), -1, NULL, 0);
-		std::wstring wideText(size_needed, 0);
-		MultiByteToWideChar(CP_UTF8, 0, reinterpret_cast<const char*>(text), -1, &wideText[0], size_needed);
+		if (CheckScalarLength(In_YAMLLines, In_Value.size()) && AddParsedNode(In_YAMLLines)) In_Handler.OnScalar(In_Value, In_MultilineType);
+	}
 
-		size_needed = WideCharToMultiByte(932, 0, wideText.c_str(), -1, NULL, 0, NULL, NULL);
-		std::string shiftJISText(size_needed, 0);
-		WideCharToMultiByte(932, 0, wideText.c_str(), -1, &shiftJISText[0], size_needed, NULL, NULL);
+	/// <summary>
+	/// l̐擪AJ[(&amp;name)ł OnAnchor ŁAGCAX(*name)ł OnAlias Œʒm܂B
+	/// </summary>
+	/// <param name="In_Value">lBAJ[̏ꍇ͂̌̒lAGCAX̏ꍇ͖O̒w悤ɐi߂܂B</param>
+	/// <returns>GCAXʒmꍇ true Ԃ܂Bl͂ŊĂ邽߁AǂޕKv͂܂B</returns>
+	template <class Handler>
+	static bool ParseProperties(_Inout_ YAMLLines& In_YAMLLines, _Inout_ std::string_view& In_Value, _Inout_ Handler& In_Handler)
+	{
+		if (In_Value.size() < 2 || (In_Value[0] != '&' && In_Value[0] != '*')) return false;
+		const size_t end = ScanAnchorName(In_Value, 1);
+		if (end == 1) return false;
+		const std::string_view name = In_Value.substr(1, end - 1);
+		if (In_Value[0] == '*')
+		{
+			In_Value = In_Value.substr(end);
+			if (AddParsedNode(In_YAMLLines)) In_Handler.OnAlias(name);
+			return true;
+		}
+		if (!In_YAMLLines.failed) In_Handler.OnAnchor(name);
+		In_Value = TrimLeftWhitespace(In_Value.substr(end));
+		return false;
+	}
 
-		return shiftJISText;
+	/// <summary>
+	/// lvfɎt[`̃V[PX([1, 2.5, -3e2])ApqlȂPȑŗvfɕ܂B
+	/// lȊO̕܂ޏꍇ͉ʒm npos Ԃ܂B
+	/// </summary>
+	/// <returns>ʂ̒̈ʒuB</returns>
+	template <class Handler>
+	static size_t ParseNumericFlowSeq(_Inout_ YAMLLines& In_YAMLLines, _In_ std::string_view In_Text, _In_ const size_t& In_Pos, _Inout_ Handler& In_Handler)
+	{
+		const size_t close = In_Text.find(']', In_Pos + 1);
+		if (close == std::string_view::npos) return std::string_view::npos;
+		const std::string_view body = In_Text.substr(In_Pos + 1, close - In_Pos - 1);
+
+		bool hasDigit = false;
+		for (const char c : body)
+		{
+			if (c >= '0' && c <= '9')
+				hasDigit = true;
+			else if (c != ',' && c != '+' && c != '-' && c != '.' && c != 'e' && c != 'E' && !IsFlowSpace(c))
+				return std::string_view::npos;
+		}
+		if (!hasDigit) return std::string_view::npos;
+
+		if (!EnterContainer(In_YAMLLines)) return close + 1;
+		In_Handler.OnSeqStart();
+		size_t pos = 0;
+		while (pos < body.size() && !In_YAMLLines.failed)
+		{
+			const size_t end = (std::min)(body.find(',', pos), body.size());
+			const std::string_view item = FlowToken(body, SkipFlowSpace(body, pos), end);
+			if (!item.empty()) EmitScalar(In_YAMLLines, In_Handler, item);
+			pos = end + 1;
+		}
+		LeaveContainer(In_YAMLLines);
+		if (!In_YAMLLines.failed) In_Handler.OnSeqEnd();
+		return close + 1;
 	}
 
-	static inline std::string ParseMultilineScalar(_Inout_ YAMLLines& In_YAMLLines, _In_ const size_t& In_BaseIndent)
+	/// <summary>
+	/// t[`̃RNVJ܂Bl̃V[PX͂̏ŕʂ܂œǂݐ؂܂B
+	/// </summary>
+	/// <param name="Out_Open">JĂRNV̕ʂ̃X^bNB</param>
+	/// <returns>J(ǂݐ؂ꍇ͕)̒̈ʒuB</returns>
+	template <class Handler>
+	static size_t OpenFlow(_Inout_ YAMLLines& In_YAMLLines, _In_ std::string_view In_Text, _In_ const size_t& In_Pos,
+		_Inout_ Handler& In_Handler, _Inout_ std::string& Out_Open)
 	{
-		std::vector<std::string> lines;
-		size_t minIndent = std::string::npos;
+		const bool isMap = In_Text[In_Pos] == '{';
+		if (!isMap)
+		{
+			const size_t end = ParseNumericFlowSeq(In_YAMLLines, In_Text, In_Pos, In_Handler);
+			if (end != std::string_view::npos) return end;
+		}
+		if (!EnterContainer(In_YAMLLines)) return In_Text.size();
+		if (isMap) In_Handler.OnMapStart();
+		else In_Handler.OnSeqStart();
+		Out_Open += isMap ? '}' : ']';
+		return In_Pos + 1;
+	}
 
-		while (!In_YAMLLines.eof())
+	template <class Handler>
+	static void CloseFlow(_Inout_ YAMLLines& In_YAMLLines, _Inout_ Handler& In_Handler, _Inout_ std::string& Out_Open)
+	{
+		const bool isMap = Out_Open.back() == '}';
+		Out_Open.pop_back();
+		LeaveContainer(In_YAMLLines);
+		if (In_YAMLLines.failed) return;
+		if (isMap) In_Handler.OnMapEnd();
+		else In_Handler.OnSeqEnd();
+	}
+
+	/// <summary>
+	/// ʂ̑ΉmFς݂̃t[`̃RNVp[XACxgnh[ɒʒm܂B
+	/// ̗vf▖̋؂͖܂Bq͍ċAɕʂ̃X^bNŒH܂B
+	/// </summary>
+	/// <param name="In_Pos">Jʂ̈ʒuB</param>
+	/// <returns>ʂ̒̈ʒuB</returns>
+	template <class Handler>
+	static size_t ParseFlow(_Inout_ YAMLLines& In_YAMLLines, _In_ std::string_view In_Text, _In_ size_t In_Pos, _Inout_ Handler& In_Handler)
+	{
+		std::string open;
+		In_Pos = OpenFlow(In_YAMLLines, In_Text, In_Pos, In_Handler, open);
+		while (!open.empty() && !In_YAMLLines.failed)
 		{
-			const std::string& line = In_YAMLLines.peek();
-			if (line.empty())
+			In_Pos = SkipFlowSpace(In_Text, In_Pos);
+			if (In_Pos >= In_Text.size()) break;
+			const char c = In_Text[In_Pos];
+			if (c == ']' || c == '}')
 			{
-				lines.push_back("");
-				In_YAMLLines.next();
+				++In_Pos;
+				CloseFlow(In_YAMLLines, In_Handler, open);
+				continue;
+			}
+			if (c == ',')
+			{
+				++In_Pos;
 				continue;
 			}
-			const size_t indent = IndentCounter(line);
-			if (indent < In_BaseIndent) break;
 
-			lines.push_back(line);
-			if (line.find_first_not_of(" \t") != std::string::npos)
-#undef min
-				minIndent = std::min(minIndent, indent);
+			if (open.back() == '}')
+			{
+				if (c == '[' || c == '{')
+				{
+					// RNVL[ɂ邱Ƃ͂łȂߓǂݔ΂
+					FlowScanState skip;
+					ScanFlow(In_Text.substr(In_Pos), skip);
+					In_Pos += skip.pos;
+					continue;
+				}
+				const size_t keyEnd = ScanFlowScalar(In_Text, In_Pos, true);
+				EmitKey(In_YAMLLines, In_Handler, FlowToken(In_Text, In_Pos, keyEnd));
+				In_Pos = keyEnd;
+				if (In_Pos >= In_Text.size() || In_Text[In_Pos] != ':')
+				{
+					EmitScalar(In_YAMLLines, In_Handler, std::string_view());
+					continue;
+				}
+				In_Pos = SkipFlowSpace(In_Text, In_Pos + 1);
+				if (In_Pos >= In_Text.size()) break;
+			}
 
-			In_YAMLLines.next();
+			std::string_view rest = In_Text.substr(In_Pos);
+			const bool alias = ParseProperties(In_YAMLLines, rest, In_Handler);
+			In_Pos = SkipFlowSpace(In_Text, In_Text.size() - rest.size());
+			if (alias) continue;
+			if (In_Pos >= In_Text.size()) break;
+
+			if (In_Text[In_Pos] == '[' || In_Text[In_Pos] == '{')
+			{
+				In_Pos = OpenFlow(In_YAMLLines, In_Text, In_Pos, In_Handler, open);
+				continue;
+			}
+			const size_t end = ScanFlowScalar(In_Text, In_Pos, false);
+			EmitScalar(In_YAMLLines, In_Handler, FlowToken(In_Text, In_Pos, end));
+			In_Pos = end;
 		}
 
-		if (minIndent == std::string::npos) minIndent = In_BaseIndent;
+		// eLXg̏I܂ŕĂȂRNV
+		while (!open.empty()) CloseFlow(In_YAMLLines, In_Handler, open);
+		return In_Pos;
+	}
 
-		for (auto& lineContent : lines)
+	/// <summary>
+	/// t[`̃RNVŎn܂lp[XACxgnh[ɒʒm܂B
+	/// ʂsŕĂȂꍇ́ACfg In_MinIndent ȏ̌㑱̍s(ʂŎn܂s͐[Ȃ)pēǂݐi߂܂B
+	/// ʂȂA܂͕ʂ̌ɃRgȊOꍇ́Aǂݐi߂ʒu߂ false Ԃ܂(Cxg͒ʒm܂)B
+	/// slp͈͂̍sn܂ĺA̍sœǂ݂܂(q̊ʂƂɓsǂݒȂ)B
+	/// </summary>
+	/// <param name="In_Value">݂̍s؂olB̍s͓ǂݐiߍς݂ł邱ƁB</param>
+	/// <param name="In_MinIndent">psƂĈŏ̃CfgB</param>
+	template <class Handler>
+	static bool ParseFlowValue(_Inout_ YAMLLines& In_YAMLLines, _In_ std::string_view In_Value, _In_ const size_t& In_MinIndent, _Inout_ Handler& In_Handler)
+	{
+		const size_t resumePos = In_YAMLLines.currentPos;
+		std::string_view text = In_Value;
+		FlowScanState state;
+		bool closed = ScanFlow(text, state);
+		if (!closed && resumePos >= In_YAMLLines.flowScanEnd)
 		{
-			if (lineContent.size() >= minIndent)
-				lineContent = lineContent.substr(minIndent);
-			while (!lineContent.empty() && (lineContent.back() == '\r'))
-				lineContent.pop_back();
+			std::string& joined = In_YAMLLines.scratch;
+			joined.assign(In_Value);
+			while (!closed && !In_YAMLLines.eof())
+			{
+				const std::string_view line = In_YAMLLines.peek();
+				const std::string_view trimmed = TrimLeftWhitespace(line);
+				// ʂ̓L[Ɠ[ɒuĂ悢
+				if (!trimmed.empty() && trimmed[0] != ']' && trimmed[0] != '}' && IndentCounter(line) < In_MinIndent) break;
+				joined += '\n';
+				joined += line;
+				In_YAMLLines.next();
+				closed = ScanFlow(joined, state);
+			}
+			text = joined;
 		}
 
-		std::string result;
-		for (size_t i = 0; i < lines.size(); ++i)
+		if (closed)
+		{
+			const size_t tail = SkipFlowSpace(text, state.pos);
+			if (tail >= text.size() || text[tail] == '#')
+			{
+				ParseFlow(In_YAMLLines, text, 0, In_Handler);
+				return true;
+			}
+		}
+		In_YAMLLines.flowScanEnd = (std::max)(In_YAMLLines.flowScanEnd, In_YAMLLines.currentPos);
+		In_YAMLLines.currentPos = resumePos;
+		if (In_YAMLLines.diagnostics)
 		{
-			result += lines[i];
-			if (i + 1 < lines.size()) result += "\n";
+			const size_t lineIndex = resumePos - 1;
+			Report(In_YAMLLines, LogLevel::Warning, lineIndex, static_cast<size_t>(In_Value.data() - In_YAMLLines.lines[lineIndex].data()),
+				closed ? "t[`̕ʂ̌ɒl邽߁AƂēǂݍ݂܂" : "t[`̊ʂĂȂ߁AƂēǂݍ݂܂");
 		}
+		return false;
+	}
 
-		return result;
+	/// <summary>
+	/// hLgS(Cfg0̃L[1̃}bv)p[XACxgnh[ɒʒm܂B
+	/// lXg͍ċA BlockFrame ̃X^bNŒHAesX񐔂ׂȂ߁A͂̒ɔႷ鎞ԂŏI܂B
+	/// 𒴂ꍇ͂̎_ŃCxg̒ʒm߁Afalse Ԃ܂(JĂRei͕܂)B
+	/// </summary>
+	template <class Handler>
+	static bool ParseDocument(_Inout_ YAMLLines& In_YAMLLines, _Inout_ Handler& In_Handler)
+	{
+		std::vector<BlockFrame> frames;
+		OpenBlock(In_YAMLLines, frames, BlockFrame::Kind::Document, 0, In_Handler);
+		while (!frames.empty() && !In_YAMLLines.failed)
+		{
+			if (In_YAMLLines.control && In_YAMLLines.currentPos >= In_YAMLLines.nextControlPos && !PollControl(In_YAMLLines)) break;
+
+			// q̃ReiJƃX^bNLт邽߁At[͒lŎ󂯎
+			const BlockFrame frame = frames.back();
+			bool finished = false;
+			switch (frame.kind)
+			{
+			case BlockFrame::Kind::Document: finished = StepDocument(In_YAMLLines, frames, In_Handler); break;
+			case BlockFrame::Kind::Map: finished = StepMap(In_YAMLLines, frames, frame.indent, In_Handler); break;
+			case BlockFrame::Kind::Seq: finished = StepSeq(In_YAMLLines, frames, frame.indent, In_Handler); break;
+			case BlockFrame::Kind::SeqItemMap: finished = StepSeqItemMap(In_YAMLLines, frames, frame.indent, In_Handler); break;
+			}
+			if (!finished || In_YAMLLines.failed) continue;
+
+			frames.pop_back();
+			LeaveContainer(In_YAMLLines);
+			if (frame.kind == BlockFrame::Kind::Seq) In_Handler.OnSeqEnd();
+			else In_Handler.OnMapEnd();
+		}
+		return !In_YAMLLines.failed;
 	}
 
-	static inline std::shared_ptr<YAMLNode> ParseNode(_Inout_ YAMLLines& In_YAMLLines, _In_ const size_t& In_CurrentIndent)
+	// ubN`̃ReiJAX^bNɐς݂܂B
+	template <class Handler>
+	static void OpenBlock(_Inout_ YAMLLines& In_YAMLLines, _Inout_ std::vector<BlockFrame>& Out_Frames,
+		_In_ const BlockFrame::Kind& In_Kind, _In_ const size_t& In_Indent, _Inout_ Handler& In_Handler)
 	{
-		if (In_YAMLLines.eof()) return std::make_shared<YAMLNode>(std::string{});
+		if (!EnterContainer(In_YAMLLines)) return;
+		if (In_Kind == BlockFrame::Kind::Seq) In_Handler.OnSeqStart();
+		else In_Handler.OnMapStart();
+		Out_Frames.push_back({ In_Kind, In_Indent });
+	}
 
-		const std::string& line = In_YAMLLines.peek();
-		const size_t indent = IndentCounter(line);
-		const std::string trimmed = TrimLeftWhitespace(line);
+	// ȉ Step n֐́At[̗vf1(܂͋s1s)ǂݐi߂܂B
+	// ߂l̓ReiIǂŁAq̃ReiJꍇ͐ς񂾂Ŗ߂܂B
+
+	template <class Handler>
+	static bool StepDocument(_Inout_ YAMLLines& In_YAMLLines, _Inout_ std::vector<BlockFrame>& Out_Frames, _Inout_ Handler& In_Handler)
+	{
+		if (In_YAMLLines.eof()) return true;
+		const std::string_view line = In_YAMLLines.peek();
+		const std::string_view trimmed = TrimLeftWhitespace(line);
 
 		if (trimmed.empty() || trimmed[0] == '#')
 		{
 			In_YAMLLines.next();
-			return ParseNode(In_YAMLLines, In_CurrentIndent);
+			return false;
 		}
-		if (trimmed[0] == '-')
+		const size_t indent = IndentCounter(line);
+
+		if (indent != 0)
 		{
-			return ParseSeq(In_YAMLLines, indent);
+			ReportSkippedLine(In_YAMLLines, "ǂ̃L[̒lɂȂȂCfg̍s邽߁Aȍ~ǂݍ݂܂ł");
+			return true;
 		}
-		if (trimmed.find(':') != std::string::npos)
+
+		const size_t colon_pos = trimmed.find(':');
+		if (colon_pos == std::string::npos)
 		{
-			return ParseMap(In_YAMLLines, indent);
+			ReportSkippedLine(In_YAMLLines, "L[̋؂(:)Ȃs邽߁Aȍ~ǂݍ݂܂ł");
+			return true;
 		}
-
+		EmitKey(In_YAMLLines, In_Handler, trimmed.substr(0, colon_pos));
 		In_YAMLLines.next();
-		return std::make_shared<YAMLNode>(trimmed);
+
+		std::string_view value = TrimLeftWhitespace(trimmed.substr(colon_pos + 1));
+		if (ParseProperties(In_YAMLLines, value, In_Handler)) return false;
+		if (IsFlowStart(value) && ParseFlowValue(In_YAMLLines, value, 1, In_Handler)) return false;
+
+		if (!In_YAMLLines.eof())
+		{
+			const std::string_view next_line = In_YAMLLines.peek();
+			const size_t next_indent = IndentCounter(next_line);
+
+			if (next_indent > indent)
+			{
+				ReportDiscardedValue(In_YAMLLines, value);
+				ParseNode(In_YAMLLines, Out_Frames, In_Handler);
+				return false;
+			}
+		}
+		EmitScalar(In_YAMLLines, In_Handler, value);
+		return false;
 	}
 
-	static std::shared_ptr<YAMLNode> ParseMap(_Inout_ YAMLLines& In_YAMLLines, _In_ const size_t& In_CurrentIndent)
+	/// <summary>
+	/// l̈ʒuɂm[h̎ނ𔻒肵AXJ[łΒʒmAReiłΊJăX^bNɐς݂܂B
+	/// </summary>
+	template <class Handler>
+	static void ParseNode(_Inout_ YAMLLines& In_YAMLLines, _Inout_ std::vector<BlockFrame>& Out_Frames, _Inout_ Handler& In_Handler)
 	{
-		YAMLMap map;
-		while (!In_YAMLLines.eof())
+		while (true)
 		{
-			const std::string& line = In_YAMLLines.peek();
-			if (line.empty() || line.find_first_not_of(" \t") == std::string::npos || line[0] == '#')
+			if (In_YAMLLines.eof())
 			{
-				In_YAMLLines.next();
-				continue;
+				EmitScalar(In_YAMLLines, In_Handler, std::string_view());
+				return;
 			}
+
+			const std::string_view line = In_YAMLLines.peek();
 			const size_t indent = IndentCounter(line);
-			if (indent < In_CurrentIndent) break;
-			if (indent > In_CurrentIndent) continue;
+			const std::string_view trimmed = TrimLeftWhitespace(line);
 
-			const std::string trimmed = TrimLeftWhitespace(line);
-			const size_t colon_pos = trimmed.find(':');
-			if (colon_pos == std::string::npos)
+			if (trimmed.empty() || trimmed[0] == '#')
 			{
 				In_YAMLLines.next();
 				continue;
 			}
-
-			const std::string key = trimmed.substr(0, colon_pos);
-			std::string val = TrimLeftWhitespace(trimmed.substr(colon_pos + 1));
-			In_YAMLLines.next();
-
-			val.erase(std::find_if(val.rbegin(), val.rend(), [](unsigned char ch)
-				{ return !std::isspace(ch); }).base(), val.end());
-
-			if (val == "|" || val == ">")
+			if (trimmed[0] == '-')
 			{
-				std::string multi = ParseMultilineScalar(In_YAMLLines, In_CurrentIndent + 2);
-				YAMLNode::MultilineType mtype = (val == "|") ? YAMLNode::MultilineType::Literal : YAMLNode::MultilineType::Folded;
-				map[key] = std::make_shared<YAMLNode>(multi, mtype);
-				continue;
+				OpenBlock(In_YAMLLines, Out_Frames, BlockFrame::Kind::Seq, indent, In_Handler);
+				return;
 			}
-
-			if (!In_YAMLLines.eof())
+			if (IsFlowStart(trimmed))
 			{
-				const std::string& next_line = In_YAMLLines.peek();
-				const size_t next_indent = IndentCounter(next_line);
-				const std::string next_trimmed = TrimLeftWhitespace(next_line);
-
-				if ((val.empty() && next_indent > indent && !next_trimmed.empty()) ||
-					(next_indent > indent && !next_trimmed.empty() && (next_trimmed[0] == '-' || next_trimmed.find(':') != std::string::npos)))
-				{
-					map[key] = ParseNode(In_YAMLLines, next_indent);
-					continue;
-				}
+				In_YAMLLines.next();
+				if (ParseFlowValue(In_YAMLLines, trimmed, indent, In_Handler)) return;
+				EmitScalar(In_YAMLLines, In_Handler, trimmed);
+				return;
+			}
+			if (trimmed.find(':') != std::string::npos)
+			{
+				OpenBlock(In_YAMLLines, Out_Frames, BlockFrame::Kind::Map, indent, In_Handler);
+				return;
 			}
 
-			map[key] = std::make_shared<YAMLNode>(val);
+			In_YAMLLines.next();
+			EmitScalar(In_YAMLLines, In_Handler, trimmed);
+			return;
 		}
-
-		return std::make_shared<YAMLNode>(map);
 	}
 
-	static std::shared_ptr<YAMLNode> ParseSeq(_Inout_ YAMLLines& In_YAMLLines, _In_ const size_t& In_CurrentIndent)
+	template <class Handler>
+	static bool StepMap(_Inout_ YAMLLines& In_YAMLLines, _Inout_ std::vector<BlockFrame>& Out_Frames, _In_ const size_t& In_CurrentIndent, _Inout_ Handler& In_Handler)
 	{
-		YAMLSeq seq;
-		while (!In_YAMLLines.eof())
+		if (In_YAMLLines.eof()) return true;
+		const std::string_view line = In_YAMLLines.peek();
+		if (line.empty() || line.find_first_not_of(" \t") == std::string::npos || line[0] == '#')
 		{
-			const std::string& line = In_YAMLLines.peek();
-			if (line.empty() || line.find_first_not_of(" \t") == std::string::npos || line[0] == '#')
-			{
-				In_YAMLLines.next();
-				continue;
-			}
-			const size_t indent = IndentCounter(line);
-			if (indent < In_CurrentIndent) break;
-			if (indent > In_CurrentIndent)
+			In_YAMLLines.next();
+			return false;
+		}
+		const size_t indent = IndentCounter(line);
+		if (indent < In_CurrentIndent) return true;
+		if (indent > In_CurrentIndent)
+		{
+			// ǂ̃L[̒lɂȂȂ[s͓ǂݔ΂
+			ReportSkippedLine(In_YAMLLines, "ǂ̃L[̒lɂȂȂCfg̍sǂݔ΂܂");
+			In_YAMLLines.next();
+			return false;
+		}
+
+		const std::string_view trimmed = TrimLeftWhitespace(line);
+		const size_t colon_pos = trimmed.find(':');
+		if (colon_pos == std::string::npos)
+		{
+			ReportSkippedLine(In_YAMLLines, "L[̋؂(:)Ȃsǂݔ΂܂");
+			In_YAMLLines.next();
+			return false;
+		}
+
+		std::string_view val = TrimLeftWhitespace(trimmed.substr(colon_pos + 1));
+		EmitKey(In_YAMLLines, In_Handler, trimmed.substr(0, colon_pos));
+		In_YAMLLines.next();
+
+		while (!val.empty() && std::isspace(static_cast<unsigned char>(val.back())))
+			val.remove_suffix(1);
+		if (ParseProperties(In_YAMLLines, val, In_Handler)) return false;
+
+		if (val == "|" || val == ">")
+		{
+			YAMLNode::MultilineType mtype = (val == "|") ? YAMLNode::MultilineType::Literal : YAMLNode::MultilineType::Folded;
+			EmitScalar(In_YAMLLines, In_Handler, ParseMultilineScalar(In_YAMLLines, In_CurrentIndent + 2), mtype);
+			return false;
+		}
+		if (IsFlowStart(val) && ParseFlowValue(In_YAMLLines, val, indent + 1, In_Handler)) return false;
+
+		if (!In_YAMLLines.eof())
+		{
+			const std::string_view next_line = In_YAMLLines.peek();
+			const size_t next_indent = IndentCounter(next_line);
+			const std::string_view next_trimmed = TrimLeftWhitespace(next_line);
+
+			if ((val.empty() && next_indent > indent && !next_trimmed.empty()) ||
+				(next_indent > indent && !next_trimmed.empty() && (next_trimmed[0] == '-' || next_trimmed.find(':') != std::string::npos)))
 			{
-				In_YAMLLines.next();
-				continue;
+				ReportDiscardedValue(In_YAMLLines, val);
+				ParseNode(In_YAMLLines, Out_Frames, In_Handler);
+				return false;
 			}
+		}
+
+		EmitScalar(In_YAMLLines, In_Handler, val);
+		return false;
+	}
 
-			const std::string trimmed = TrimLeftWhitespace(line);
-			if (trimmed[0] != '-') break;
+	// "- \"a: b\"" ̂悤ɁApň͂܂ꂽl̗vf(̃Rg͏)B ':' L[̋؂Ƃ݂ȂȂ
+	static inline bool IsQuotedItem(_In_ std::string_view In_Item) noexcept
+	{
+		if (In_Item.empty() || (In_Item[0] != '"' && In_Item[0] != '\'')) return false;
+		size_t close = 1;
+		while (close < In_Item.size() && In_Item[close] != In_Item[0])
+			close += (In_Item[close] == '\\' && In_Item[0] == '"') ? 2 : 1;
+		if (close >= In_Item.size()) return false;
+		const size_t rest = In_Item.find_first_not_of(" \t", close + 1);
+		return rest == std::string_view::npos || (In_Item[rest] == '#' && In_Item[rest - 1] != In_Item[0]);
+	}
 
-			const std::string after_dash = TrimLeftWhitespace(trimmed.substr(1));
+	template <class Handler>
+	static bool StepSeq(_Inout_ YAMLLines& In_YAMLLines, _Inout_ std::vector<BlockFrame>& Out_Frames, _In_ const size_t& In_CurrentIndent, _Inout_ Handler& In_Handler)
+	{
+		if (In_YAMLLines.eof()) return true;
+		const std::string_view line = In_YAMLLines.peek();
+		if (line.empty() || line.find_first_not_of(" \t") == std::string::npos || line[0] == '#')
+		{
+			In_YAMLLines.next();
+			return false;
+		}
+		const size_t indent = IndentCounter(line);
+		if (indent < In_CurrentIndent) return true;
+		if (indent > In_CurrentIndent)
+		{
+			ReportSkippedLine(In_YAMLLines, "ǂ̗vf̒lɂȂȂCfg̍sǂݔ΂܂");
 			In_YAMLLines.next();
+			return false;
+		}
+
+		const std::string_view trimmed = TrimLeftWhitespace(line);
+		if (trimmed.empty() || trimmed[0] != '-') return true;
+
+		std::string_view after_dash = TrimLeftWhitespace(trimmed.substr(1));
+		In_YAMLLines.next();
+		if (ParseProperties(In_YAMLLines, after_dash, In_Handler)) return false;
+
+		// "- {a: 1}" ̂悤Ƀt[`̒ ':' Ă}bv̗vfƂ݂͂ȂȂ
+		if (IsFlowStart(after_dash) && ParseFlowValue(In_YAMLLines, after_dash, In_CurrentIndent + 1, In_Handler)) return false;
 
-			if (!after_dash.empty() && after_dash.find(':') == std::string::npos)
+		if (!after_dash.empty() && (after_dash.find(':') == std::string::npos || IsQuotedItem(after_dash)))
+		{
+			EmitScalar(In_YAMLLines, In_Handler, after_dash);
+			return false;
+		}
+		// "-" ̍sɑ[V[PX́AV[PX̗vfƂẴV[PX
+		if (after_dash.empty() && !In_YAMLLines.eof())
+		{
+			const std::string_view next_line = In_YAMLLines.peek();
+			const std::string_view next_trimmed = TrimLeftWhitespace(next_line);
+			const size_t next_indent = IndentCounter(next_line);
+			if (next_indent > In_CurrentIndent && !next_trimmed.empty() && next_trimmed[0] == '-')
 			{
-				seq.push_back(std::make_shared<YAMLNode>(after_dash));
-				continue;
+				OpenBlock(In_YAMLLines, Out_Frames, BlockFrame::Kind::Seq, next_indent, In_Handler);
+				return false;
 			}
+		}
 
-			YAMLMap one_map;
-			if (!after_dash.empty())
+		// vf̃}bv̎c̃L[ StepSeqItemMap ǂ
+		OpenBlock(In_YAMLLines, Out_Frames, BlockFrame::Kind::SeqItemMap, In_CurrentIndent, In_Handler);
+		if (!after_dash.empty())
+		{
+			const size_t colon_pos = after_dash.find(':');
+			if (colon_pos != std::string::npos)
 			{
-				const size_t colon_pos = after_dash.find(':');
-				if (colon_pos != std::string::npos)
-				{
-					one_map[after_dash.substr(0, colon_pos)] =
-						std::make_shared<YAMLNode>(
-							TrimLeftWhitespace(after_dash.substr(colon_pos + 1))
-						);
-				}
+				EmitKey(In_YAMLLines, In_Handler, after_dash.substr(0, colon_pos));
+				std::string_view value = TrimLeftWhitespace(after_dash.substr(colon_pos + 1));
+				if (!ParseProperties(In_YAMLLines, value, In_Handler) &&
+					(!IsFlowStart(value) || !ParseFlowValue(In_YAMLLines, value, In_CurrentIndent + 1, In_Handler)))
+					EmitScalar(In_YAMLLines, In_Handler, value);
 			}
+		}
+		return false;
+	}
 
-			while (!In_YAMLLines.eof())
-			{
-				const std::string& next_line = In_YAMLLines.peek();
-				const size_t next_indent = IndentCounter(next_line);
-				const std::string next_trimmed = TrimLeftWhitespace(next_line);
+	template <class Handler>
+	static bool StepSeqItemMap(_Inout_ YAMLLines& In_YAMLLines, _Inout_ std::vector<BlockFrame>& Out_Frames, _In_ const size_t& In_SeqIndent, _Inout_ Handler& In_Handler)
+	{
+		if (In_YAMLLines.eof()) return true;
+		const std::string_view next_line = In_YAMLLines.peek();
+		const size_t next_indent = IndentCounter(next_line);
+		const std::string_view next_trimmed = TrimLeftWhitespace(next_line);
 
-				if (next_indent == In_CurrentIndent + 2 && next_trimmed.find(':') != std::string::npos && next_trimmed[0] != '-')
-				{
-					const size_t colon_pos = next_trimmed.find(':');
-					const std::string key = next_trimmed.substr(0, colon_pos);
-					In_YAMLLines.next();
+		if (next_indent != In_SeqIndent + 2 || next_trimmed.find(':') == std::string::npos || next_trimmed[0] == '-') return true;
 
-					if (!In_YAMLLines.eof())
-					{
-						const std::string& peek_line = In_YAMLLines.peek();
-						const size_t peek_indent = IndentCounter(peek_line);
-						if (peek_indent > next_indent)
-						{
-							one_map[key] = ParseNode(In_YAMLLines, peek_indent);
-							continue;
-						}
-					}
-					one_map[key] = std::make_shared<YAMLNode>(TrimLeftWhitespace(next_trimmed.substr(colon_pos + 1)));
-				}
-				else
-				{
-					break;
-				}
+		const size_t colon_pos = next_trimmed.find(':');
+		EmitKey(In_YAMLLines, In_Handler, next_trimmed.substr(0, colon_pos));
+		In_YAMLLines.next();
+
+		std::string_view value = TrimLeftWhitespace(next_trimmed.substr(colon_pos + 1));
+		if (ParseProperties(In_YAMLLines, value, In_Handler)) return false;
+		if (IsFlowStart(value) && ParseFlowValue(In_YAMLLines, value, next_indent + 1, In_Handler)) return false;
+
+		if (!In_YAMLLines.eof())
+		{
+			const std::string_view peek_line = In_YAMLLines.peek();
+			const size_t peek_indent = IndentCounter(peek_line);
+			if (peek_indent > next_indent)
+			{
+				ReportDiscardedValue(In_YAMLLines, value);
+				ParseNode(In_YAMLLines, Out_Frames, In_Handler);
+				return false;
 			}
-			seq.push_back(std::make_shared<YAMLNode>(one_map));
 		}
-		return std::make_shared<YAMLNode>(seq);
+		EmitScalar(In_YAMLLines, In_Handler, value);
+		return false;
 	}
 
 };
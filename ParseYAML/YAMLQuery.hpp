@@ -0,0 +1,738 @@
+#pragma once
+
+#include "YAMLParser.hpp"
+
+/// <summary>
+/// m[hc[̃m[h𕡐ɎQƂr[łBlz̗vf̂悤Ƀm[hȂl\܂B
+/// QƐ̃p[T[(܂̓Xg[]̃R[obN)LȊԂg܂B
+/// </summary>
+class YAMLNodeView
+{
+public:
+	YAMLNodeView() = default;
+	explicit YAMLNodeView(_In_ const YAMLParser::YAMLNode& In_Node) noexcept : m_Node(&In_Node) {}
+	YAMLNodeView(_In_ const YAMLParser::YAMLNumericArray& In_Array, _In_ const size_t& In_Index) noexcept : m_Array(&In_Array), m_Index(In_Index) {}
+
+	// QƂĂm[hBlz̗vf̏ꍇ nullptr
+	inline const YAMLParser::YAMLNode* GetNode() const noexcept { return m_Node; }
+
+	inline bool IsScalar() const noexcept { return m_Array || (m_Node && m_Node->type == YAMLParser::YAMLNode::Type::Scalar); }
+
+	/// <summary>
+	/// XJ[̒l YAMLParser::GetString ƓŐ󔒂ƈpĎ擾܂BReȉꍇ͋󕶎Ԃ܂B
+	/// </summary>
+	inline std::string GetString() const
+	{
+		char buffer[YAMLParser::YAMLNumericArray::FormatBufferSize];
+		return std::string(GetText(buffer));
+	}
+
+	inline int GetInt() const noexcept { return ToNumber<int>(); }
+	inline double GetDouble() const noexcept { return ToNumber<double>(); }
+	inline bool GetBool() const
+	{
+		char buffer[YAMLParser::YAMLNumericArray::FormatBufferSize];
+		const std::string_view text = GetText(buffer);
+		return text == "true" || text == "True" || text == "1";
+	}
+
+	/// <summary>
+	/// XJ[̒lAKvȏꍇ In_Buffer ɏĎQƂ܂B߂l In_Buffer ƃm[hLȊԂg܂B
+	/// </summary>
+	std::string_view GetText(_Out_ char(&Out_Buffer)[YAMLParser::YAMLNumericArray::FormatBufferSize]) const
+	{
+		if (m_Array) return m_Array->Format(m_Index, Out_Buffer);
+		if (!m_Node || m_Node->type != YAMLParser::YAMLNode::Type::Scalar) return std::string_view();
+		return YAMLParser::UnquoteScalar(std::get<YAMLParser::YAMLScalar>(m_Node->value));
+	}
+
+	/// <summary>
+	/// qvfɗ񋓂܂B}bv̗vf (L[, Y SIZE_MAX, l)AV[PX̗vf (̃L[, Y, l) Ƃēn܂B
+	/// </summary>
+	template <class Function>
+	void ForEachChild(_In_ Function&& In_Function) const
+	{
+		using Type = YAMLParser::YAMLNode::Type;
+		if (!m_Node) return;
+		switch (m_Node->type)
+		{
+		case Type::Map:
+			for (const auto& keyValue : std::get<YAMLParser::YAMLMap>(m_Node->value))
+				In_Function(std::string_view(keyValue.first), SIZE_MAX, YAMLNodeView(*keyValue.second));
+			break;
+		case Type::Sequence:
+		{
+			const auto& seq = std::get<YAMLParser::YAMLSeq>(m_Node->value);
+			for (size_t i = 0; i < seq.size(); ++i)
+				In_Function(std::string_view(), i, YAMLNodeView(*seq[i]));
+			break;
+		}
+		case Type::NumericArray:
+		{
+			const auto& array = std::get<YAMLParser::YAMLNumericArray>(m_Node->value);
+			for (size_t i = 0; i < array.size(); ++i)
+				In_Function(std::string_view(), i, YAMLNodeView(array, i));
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	/// <summary>
+	/// L[܂͓YŎqvf擾܂BȂꍇ͋̃r[Ԃ܂B
+	/// </summary>
+	YAMLNodeView GetChild(_In_ std::string_view In_Key, _In_ const size_t& In_Index) const
+	{
+		using Type = YAMLParser::YAMLNode::Type;
+		if (!m_Node) return YAMLNodeView();
+		switch (m_Node->type)
+		{
+		case Type::Map:
+		{
+			const auto& map = std::get<YAMLParser::YAMLMap>(m_Node->value);
+			const auto itr = map.find(YAMLParser::YAMLString(In_Key));
+			return itr != map.end() ? YAMLNodeView(*itr->second) : YAMLNodeView();
+		}
+		case Type::Sequence:
+		{
+			const auto& seq = std::get<YAMLParser::YAMLSeq>(m_Node->value);
+			return In_Index < seq.size() ? YAMLNodeView(*seq[In_Index]) : YAMLNodeView();
+		}
+		case Type::NumericArray:
+		{
+			const auto& array = std::get<YAMLParser::YAMLNumericArray>(m_Node->value);
+			return In_Index < array.size() ? YAMLNodeView(array, In_Index) : YAMLNodeView();
+		}
+		default:
+			return YAMLNodeView();
+		}
+	}
+
+	// r[lQƂĂ邩ǂ
+	inline explicit operator bool() const noexcept { return m_Node || m_Array; }
+
+	// qvf̐BXJ[̏ꍇ 0
+	size_t GetChildCount() const noexcept
+	{
+		using Type = YAMLParser::YAMLNode::Type;
+		if (!m_Node) return 0;
+		switch (m_Node->type)
+		{
+		case Type::Map: return std::get<YAMLParser::YAMLMap>(m_Node->value).size();
+		case Type::Sequence: return std::get<YAMLParser::YAMLSeq>(m_Node->value).size();
+		case Type::NumericArray: return std::get<YAMLParser::YAMLNumericArray>(m_Node->value).size();
+		default: return 0;
+		}
+	}
+
+private:
+	template <class T>
+	T ToNumber() const noexcept
+	{
+		char buffer[YAMLParser::YAMLNumericArray::FormatBufferSize];
+		const std::string_view text = GetText(buffer);
+		T value = 0;
+		const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+		return ec == std::errc() ? value : T();
+	}
+
+	const YAMLParser::YAMLNode* m_Node = nullptr;
+	const YAMLParser::YAMLNumericArray* m_Array = nullptr;
+	size_t m_Index = 0;
+};
+
+/// <summary>
+/// L[pXg₢킹RpCAm[hc[܂̓p[XCxgɑ΂1̑ŕ]܂B
+/// ̓hbg؂̃L[pXɎ̗vf̂łB
+///   *            }bv̒lƃV[PX̗vfׂ̂
+///   [n] [a:b]    V[PX̓YƔ͈(b ͊܂܂ȂB̒l͖琔Bȗ)
+///   ..key        Cӂ̐[̎q̂AL[܂͓Yv(..*  ..[?...] )
+///   [?q]      qvf̂q𖞂́Bq "΃pX Zq l" ܂ "΃pX"(݂̔)
+/// q̑΃pX͎qvf̃L[pXŁAqvfg @ Ə܂BZq == != &lt; &lt;= &gt; &gt;= ŁA
+/// ӂlƂēǂ߂ꍇ͐lƂāAȊO͕ƂĔr܂B
+/// : records[?value &gt; 10500].name
+/// </summary>
+class YAMLQuery
+{
+public:
+	// ₢킹̃Xebv̏
+	static constexpr size_t MaxSteps = 64;
+
+	YAMLQuery() = default;
+
+	/// <summary>
+	/// ₢킹RpC܂B\Ɍ肪ꍇ̓Oɏo͂AIsValid()  false ɂȂ܂B
+	/// </summary>
+	explicit YAMLQuery(_In_ std::string_view In_Expression) { Compile(In_Expression); }
+
+	/// <summary>
+	/// ₢킹RpC܂B
+	/// </summary>
+	/// <param name="In_Expression">₢킹̕B</param>
+	/// <returns>RpCɐꍇ trueA\Ɍ肪ꍇ false Ԃ܂B</returns>
+	bool Compile(_In_ std::string_view In_Expression)
+	{
+		m_Steps.clear();
+		m_Valid = Parse(In_Expression);
+		if (!m_Valid)
+		{
+			YAMLParser::Log(YAMLParser::LogLevel::Error, "₢킹̍\܂: " + std::string(In_Expression));
+			m_Steps.clear();
+		}
+		return m_Valid;
+	}
+
+	inline bool IsValid() const noexcept { return m_Valid; }
+
+	/// <summary>
+	/// p[T[ێYAMLf[^ɑ΂ĕ]Avm[h̃r[hLg̏ɕԂ܂B
+	/// r[̓p[T[ύX܂͔j܂ŗLłB
+	/// </summary>
+	inline std::vector<YAMLNodeView> Evaluate(_In_ const YAMLParser& In_Parser) const
+	{
+		return Evaluate(In_Parser.GetRootNode());
+	}
+
+	/// <summary>
+	/// w肳ꂽm[hN_Ƃĕ]Avm[h̃r[Ԃ܂B
+	/// </summary>
+	std::vector<YAMLNodeView> Evaluate(_In_ const YAMLParser::YAMLNode& In_Root) const
+	{
+		std::vector<YAMLNodeView> results;
+		if (!m_Valid) return results;
+		const YAMLNodeView root(In_Root);
+		if (m_Steps.empty())
+		{
+			results.push_back(root);
+			return results;
+		}
+		Visit(root, 1, [&results](const YAMLNodeView& In_View) { results.push_back(In_View); });
+		return results;
+	}
+
+private:
+	// qvf̐e̒ł̈ʒu
+	struct Position
+	{
+		bool isKey = false;			// }bv̗vf(false ̏ꍇ̓V[PX̗vf)
+		std::string_view key;
+		size_t index = SIZE_MAX;
+		size_t size = SIZE_MAX;		// ẽV[PX̒(sȏꍇ SIZE_MAX)
+	};
+
+public:
+	/// <summary>
+	/// p[XCxgɑ΂Ė₢킹]nh[łBParseEvents ɓnĎg܂B
+	/// v\̂Ȃ̓m[h炸ɓǂݔ΂Aq̔ɕKvȎqvfƁAvReiTuc[ƂđgݗĂ܂B
+	/// GCAX͎QƐĐłȂ߈v܂B̓Y̓V[PX̒Ȃ߈v܂B
+	/// </summary>
+	template <class Callback>
+	class EventMatcher
+	{
+	public:
+		/// <param name="In_Query">]₢킹Bnh[蒷ێĂB</param>
+		/// <param name="In_Callback">vl̃r[󂯎֐Br[͌Ăяo̊ԂLłB</param>
+		EventMatcher(_In_ const YAMLQuery& In_Query, _In_ Callback& In_Callback) : m_Query(In_Query), m_Callback(In_Callback) {}
+
+		void OnMapStart() { Begin(true); }
+		void OnSeqStart() { Begin(false); }
+		void OnMapEnd() { End(); }
+		void OnSeqEnd() { End(); }
+
+		void OnKey(_In_ std::string_view In_Key)
+		{
+			if (m_Capture.depth > 0) m_Capture.OnKey(In_Key);
+			else if (m_SkipDepth == 0) m_Key.assign(In_Key.data(), In_Key.size());
+		}
+
+		void OnScalar(_In_ std::string_view In_Value, _In_ YAMLParser::YAMLNode::MultilineType In_MultilineType)
+		{
+			if (m_Capture.depth > 0)
+			{
+				m_Capture.OnScalar(In_Value, In_MultilineType);
+				return;
+			}
+			if (m_SkipDepth > 0 || m_Frames.empty()) return;
+
+			Frame& parent = m_Frames.back();
+			const Position position = NextPosition(parent);
+			bool candidate = false;
+			m_Query.Transition(parent.states, position, nullptr, candidate);
+			if (!candidate) return;
+			const YAMLParser::YAMLNode node(YAMLParser::YAMLScalar(In_Value), In_MultilineType);
+			m_Query.ProcessChild(parent.states, position, YAMLNodeView(node), m_Callback);
+		}
+
+		void OnAnchor(_In_ std::string_view) noexcept {}
+		void OnAlias(_In_ std::string_view)
+		{
+			if (m_Capture.depth > 0 || m_SkipDepth > 0 || m_Frames.empty()) return;
+			NextPosition(m_Frames.back());
+		}
+
+	private:
+		struct Frame
+		{
+			bool isMap;
+			size_t nextIndex;
+			uint64_t states;	// qvfɓKpXebv̏W
+		};
+
+		// v̔Ƀm[hKvȎqvfgݗĂ
+		struct Capture
+		{
+			size_t depth = 0;
+			uint64_t parentStates = 0;
+			Position position;
+			std::string key;						// position.key ̎
+			std::shared_ptr<YAMLParser::YAMLNode> root;
+			std::vector<YAMLParser::YAMLNode*> stack;
+			YAMLParser::YAMLString nextKey;
+
+			void Open(_In_ const bool& In_IsMap)
+			{
+				auto node = In_IsMap ? std::make_shared<YAMLParser::YAMLNode>(YAMLParser::YAMLMap())
+					: std::make_shared<YAMLParser::YAMLNode>(YAMLParser::YAMLSeq());
+				YAMLParser::YAMLNode* container = node.get();
+				Attach(std::move(node));
+				stack.push_back(container);
+			}
+			void OnKey(_In_ std::string_view In_Key) { nextKey.assign(In_Key.data(), In_Key.size()); }
+			void OnScalar(_In_ std::string_view In_Value, _In_ YAMLParser::YAMLNode::MultilineType In_MultilineType)
+			{
+				Attach(std::make_shared<YAMLParser::YAMLNode>(YAMLParser::YAMLScalar(In_Value), In_MultilineType));
+			}
+			void Attach(_In_ std::shared_ptr<YAMLParser::YAMLNode> In_Node)
+			{
+				if (stack.empty())
+				{
+					root = std::move(In_Node);
+					return;
+				}
+				YAMLParser::YAMLNode& parent = *stack.back();
+				if (parent.type == YAMLParser::YAMLNode::Type::Map)
+					std::get<YAMLParser::YAMLMap>(parent.value).insert_or_assign(nextKey, std::move(In_Node));
+				else
+					std::get<YAMLParser::YAMLSeq>(parent.value).push_back(std::move(In_Node));
+			}
+		};
+
+		Position NextPosition(_Inout_ Frame& In_Parent) const noexcept
+		{
+			if (In_Parent.isMap) return Position{ true, m_Key, SIZE_MAX, SIZE_MAX };
+			return Position{ false, std::string_view(), In_Parent.nextIndex++, SIZE_MAX };
+		}
+
+		void Begin(_In_ const bool& In_IsMap)
+		{
+			if (m_Capture.depth > 0)
+			{
+				++m_Capture.depth;
+				m_Capture.Open(In_IsMap);
+				return;
+			}
+			if (m_SkipDepth > 0)
+			{
+				++m_SkipDepth;
+				return;
+			}
+			if (m_Frames.empty())
+			{
+				// hLg̍ŏʁBXebv̂Ȃ₢킹͍ŏʂ̂̂Ɉv
+				if (m_Query.m_Steps.empty()) StartCapture(In_IsMap, 0, Position{});
+				else m_Frames.push_back({ In_IsMap, 0, 1 });
+				return;
+			}
+
+			Frame& parent = m_Frames.back();
+			const Position position = NextPosition(parent);
+			bool candidate = false;
+			const uint64_t states = m_Query.Transition(parent.states, position, nullptr, candidate);
+			if (candidate) StartCapture(In_IsMap, parent.states, position);
+			else if (states == 0) m_SkipDepth = 1;
+			else m_Frames.push_back({ In_IsMap, 0, states });
+		}
+
+		void StartCapture(_In_ const bool& In_IsMap, _In_ const uint64_t& In_ParentStates, _In_ const Position& In_Position)
+		{
+			m_Capture.depth = 1;
+			m_Capture.parentStates = In_ParentStates;
+			m_Capture.key.assign(In_Position.key.data(), In_Position.key.size());
+			m_Capture.position = In_Position;
+			m_Capture.Open(In_IsMap);
+		}
+
+		void End()
+		{
+			if (m_Capture.depth > 0)
+			{
+				m_Capture.stack.pop_back();
+				if (--m_Capture.depth > 0) return;
+
+				const YAMLNodeView view(*m_Capture.root);
+				if (m_Query.m_Steps.empty())
+				{
+					m_Callback(view);
+				}
+				else
+				{
+					Position position = m_Capture.position;
+					position.key = m_Capture.key;
+					m_Query.ProcessChild(m_Capture.parentStates, position, view, m_Callback);
+				}
+				m_Capture.root.reset();
+				return;
+			}
+			if (m_SkipDepth > 0) --m_SkipDepth;
+			else if (!m_Frames.empty()) m_Frames.pop_back();
+		}
+
+		const YAMLQuery& m_Query;
+		Callback& m_Callback;
+		std::vector<Frame> m_Frames;
+		std::string m_Key;				// OɒʒmꂽL[
+		size_t m_SkipDepth = 0;			// vȂReĩlXg
+		Capture m_Capture;
+	};
+
+	/// <summary>
+	/// YAMLt@Cm[hc[\zɃp[XȂ]AvlR[obNɓn܂B
+	/// </summary>
+	/// <param name="In_FilePath">ǂݍYAMLt@C̃pXB</param>
+	/// <param name="In_Callback">vl YAMLNodeView 󂯎֐Br[͌Ăяo̊ԂLłB</param>
+	/// <returns>t@Cǂݍ߂ꍇ trueAsꍇ܂͖₢킹ȏꍇ false Ԃ܂B</returns>
+	template <class Callback>
+	bool EvaluateFile(_In_ const std::string& In_FilePath, _In_ Callback&& In_Callback) const
+	{
+		if (!m_Valid) return false;
+		EventMatcher<std::remove_reference_t<Callback>> matcher(*this, In_Callback);
+		return YAMLParser::ParseEvents(In_FilePath, matcher);
+	}
+
+private:
+	enum class Compare : uint8_t
+	{
+		Exists, Equal, NotEqual, Less, LessEqual, Greater, GreaterEqual
+	};
+
+	struct Predicate
+	{
+		std::vector<std::pair<std::string, size_t>> path;	// qvf̑΃pX(L[ƁAYƂēǂ߂ꍇ̒l)
+		Compare compare = Compare::Exists;
+		std::string literal;
+		bool numeric = false;								// literal lƂēǂ߂邩
+		double number = 0.0;
+	};
+
+	struct Step
+	{
+		enum class Kind : uint8_t
+		{
+			Key,		// L[(YƂēǂ߂ꍇ̓V[PX̓Yɂv)
+			Wildcard,
+			Range,		// [begin:end]  [n]
+			Filter		// [?q]
+		};
+		Kind kind = Kind::Key;
+		bool recursive = false;		// Cӂ̐[̎qɂKp(..)
+		std::string key;
+		size_t index = SIZE_MAX;	// Key YƂēǂ߂ꍇ̒l
+		int64_t begin = 0;
+		int64_t end = INT64_MAX;
+		Predicate predicate;
+	};
+
+	// Y͈͂̒[ƂĉB̒l͖琔
+	static bool ResolveBound(_In_ const int64_t& In_Bound, _In_ const size_t& In_Size, _Out_ size_t& Out_Index) noexcept
+	{
+		if (In_Bound >= 0)
+		{
+			Out_Index = static_cast<size_t>(In_Bound);
+			return true;
+		}
+		if (In_Size == SIZE_MAX) return false;
+		const int64_t resolved = static_cast<int64_t>(In_Size) + In_Bound;
+		Out_Index = resolved < 0 ? 0 : static_cast<size_t>(resolved);
+		return true;
+	}
+
+	static bool MatchesPosition(_In_ const Step& In_Step, _In_ const Position& In_Position) noexcept
+	{
+		switch (In_Step.kind)
+		{
+		case Step::Kind::Key:
+			return In_Position.isKey ? In_Position.key == In_Step.key : In_Position.index == In_Step.index;
+		case Step::Kind::Range:
+		{
+			if (In_Position.isKey) return false;
+			size_t begin = 0, end = SIZE_MAX;
+			if (!ResolveBound(In_Step.begin, In_Position.size, begin)) return false;
+			if (In_Step.end != INT64_MAX && !ResolveBound(In_Step.end, In_Position.size, end)) return false;
+			return In_Position.index >= begin && In_Position.index < end;
+		}
+		default:
+			return true;
+		}
+	}
+
+	/// <summary>
+	/// eɓKpXebv̏WAqvfɓKpXebv̏W߂܂B
+	/// vꍇ Out_Accept  true ɂ܂BIn_Child  nullptr ̏ꍇ(Cxg̕]Ŏqvf܂Ȃꍇ)́Aq̔܂͈v̒ʒmɎqvfKvȂƂ true ɂ܂B
+	/// </summary>
+	uint64_t Transition(_In_ const uint64_t& In_States, _In_ const Position& In_Position, _In_opt_ const YAMLNodeView* In_Child,
+		_Out_ bool& Out_Accept) const
+	{
+		uint64_t next = 0;
+		Out_Accept = false;
+		for (uint64_t rest = In_States; rest != 0; rest &= rest - 1)
+		{
+			const size_t s = CountTrailingZeros(rest);
+			const Step& step = m_Steps[s];
+			if (step.recursive) next |= uint64_t(1) << s;
+			if (!MatchesPosition(step, In_Position)) continue;
+			if (step.kind == Step::Kind::Filter)
+			{
+				if (!In_Child)
+				{
+					Out_Accept = true;
+					continue;
+				}
+				if (!Test(step.predicate, *In_Child)) continue;
+			}
+			if (s + 1 == m_Steps.size()) Out_Accept = true;
+			else next |= uint64_t(1) << (s + 1);
+		}
+		return next;
+	}
+
+	// qvf𔻒肵Avꍇ͒ʒmĂA̎q]
+	template <class Emit>
+	void ProcessChild(_In_ const uint64_t& In_States, _In_ const Position& In_Position, _In_ const YAMLNodeView& In_Child, _Inout_ Emit& In_Emit) const
+	{
+		bool accept = false;
+		const uint64_t states = Transition(In_States, In_Position, &In_Child, accept);
+		if (accept) In_Emit(In_Child);
+		if (states != 0) Visit(In_Child, states, In_Emit);
+	}
+
+	template <class Emit>
+	void Visit(_In_ const YAMLNodeView& In_Node, _In_ const uint64_t& In_States, _Inout_ Emit&& In_Emit) const
+	{
+		const size_t size = In_Node.GetChildCount();
+		In_Node.ForEachChild([&](std::string_view In_Key, size_t In_Index, const YAMLNodeView& In_Child)
+			{
+				const Position position{ In_Index == SIZE_MAX, In_Key, In_Index, size };
+				ProcessChild(In_States, position, In_Child, In_Emit);
+			});
+	}
+
+	static bool Test(_In_ const Predicate& In_Predicate, _In_ const YAMLNodeView& In_Child)
+	{
+		YAMLNodeView target = In_Child;
+		for (const auto& token : In_Predicate.path)
+		{
+			target = target.GetChild(token.first, token.second);
+			if (!target) return false;
+		}
+		if (In_Predicate.compare == Compare::Exists) return true;
+		if (!target.IsScalar()) return false;
+
+		char buffer[YAMLParser::YAMLNumericArray::FormatBufferSize];
+		const std::string_view text = target.GetText(buffer);
+		int order = 0;
+		double number = 0.0;
+		const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), number);
+		if (In_Predicate.numeric && ec == std::errc() && ptr == text.data() + text.size())
+			order = (number < In_Predicate.number) ? -1 : (number > In_Predicate.number) ? 1 : 0;
+		else
+			order = text.compare(In_Predicate.literal);
+
+		switch (In_Predicate.compare)
+		{
+		case Compare::Equal: return order == 0;
+		case Compare::NotEqual: return order != 0;
+		case Compare::Less: return order < 0;
+		case Compare::LessEqual: return order <= 0;
+		case Compare::Greater: return order > 0;
+		case Compare::GreaterEqual: return order >= 0;
+		default: return false;
+		}
+	}
+
+	static inline size_t CountTrailingZeros(_In_ uint64_t In_Bits) noexcept
+	{
+		size_t count = 0;
+		while ((In_Bits & 1) == 0)
+		{
+			In_Bits >>= 1;
+			++count;
+		}
+		return count;
+	}
+
+	static size_t ToIndex(_In_ std::string_view In_Token) noexcept
+	{
+		size_t index = SIZE_MAX;
+		const auto [ptr, ec] = std::from_chars(In_Token.data(), In_Token.data() + In_Token.size(), index);
+		return (ec == std::errc() && ptr == In_Token.data() + In_Token.size()) ? index : SIZE_MAX;
+	}
+
+	static bool ParseBound(_In_ std::string_view In_Text, _In_ const int64_t& In_Default, _Out_ int64_t& Out_Value) noexcept
+	{
+		In_Text = YAMLParser::UnquoteScalar(In_Text);
+		if (In_Text.empty())
+		{
+			Out_Value = In_Default;
+			return true;
+		}
+		const auto [ptr, ec] = std::from_chars(In_Text.data(), In_Text.data() + In_Text.size(), Out_Value);
+		return ec == std::errc() && ptr == In_Text.data() + In_Text.size();
+	}
+
+	bool Parse(_In_ std::string_view In_Expression)
+	{
+		size_t pos = 0;
+		while (pos < In_Expression.size())
+		{
+			Step step;
+			if (In_Expression.compare(pos, 2, "..") == 0)
+			{
+				step.recursive = true;
+				pos += 2;
+			}
+			else if (In_Expression[pos] == '.')
+			{
+				if (m_Steps.empty()) return false;
+				++pos;
+			}
+			if (pos >= In_Expression.size()) return false;
+
+			if (In_Expression[pos] == '[')
+			{
+				const size_t close = FindClosingBracket(In_Expression, pos + 1);
+				if (close == std::string_view::npos) return false;
+				if (!ParseBracket(In_Expression.substr(pos + 1, close - pos - 1), step)) return false;
+				pos = close + 1;
+			}
+			else
+			{
+				const size_t end = (std::min)(In_Expression.find_first_of(".[", pos), In_Expression.size());
+				const std::string_view name = In_Expression.substr(pos, end - pos);
+				if (name.empty()) return false;
+				if (name == "*")
+				{
+					step.kind = Step::Kind::Wildcard;
+				}
+				else
+				{
+					step.key.assign(name.data(), name.size());
+					step.index = ToIndex(name);
+				}
+				pos = end;
+			}
+			if (m_Steps.size() == MaxSteps) return false;
+			m_Steps.push_back(std::move(step));
+		}
+		return true;
+	}
+
+	// p̒āAΉ ']' T
+	static size_t FindClosingBracket(_In_ std::string_view In_Text, _In_ size_t In_Pos) noexcept
+	{
+		char quote = 0;
+		for (; In_Pos < In_Text.size(); ++In_Pos)
+		{
+			const char c = In_Text[In_Pos];
+			if (quote)
+			{
+				if (c == quote) quote = 0;
+			}
+			else if (c == '"' || c == '\'')
+			{
+				quote = c;
+			}
+			else if (c == ']')
+			{
+				return In_Pos;
+			}
+		}
+		return std::string_view::npos;
+	}
+
+	static bool ParseBracket(_In_ std::string_view In_Body, _Inout_ Step& Out_Step)
+	{
+		In_Body = YAMLParser::UnquoteScalar(In_Body);
+		if (In_Body == "*")
+		{
+			Out_Step.kind = Step::Kind::Wildcard;
+			return true;
+		}
+		if (!In_Body.empty() && In_Body[0] == '?')
+		{
+			Out_Step.kind = Step::Kind::Filter;
+			return ParsePredicate(In_Body.substr(1), Out_Step.predicate);
+		}
+
+		Out_Step.kind = Step::Kind::Range;
+		const size_t colon = In_Body.find(':');
+		if (colon == std::string_view::npos)
+		{
+			if (!ParseBound(In_Body, 0, Out_Step.begin) || In_Body.empty()) return false;
+			Out_Step.end = Out_Step.begin + 1;
+			// [-1] ͖̗vf
+			if (Out_Step.end == 0) Out_Step.end = INT64_MAX;
+			return true;
+		}
+		return ParseBound(In_Body.substr(0, colon), 0, Out_Step.begin) &&
+			ParseBound(In_Body.substr(colon + 1), INT64_MAX, Out_Step.end);
+	}
+
+	static bool ParsePredicate(_In_ std::string_view In_Text, _Out_ Predicate& Out_Predicate)
+	{
+		In_Text = YAMLParser::UnquoteScalar(In_Text);
+		const size_t opPos = In_Text.find_first_of("=!<>");
+		std::string_view operand = YAMLParser::UnquoteScalar(In_Text.substr(0, opPos));
+		if (operand.empty()) return false;
+
+		// ΃pX(@ ͎qvfg)
+		if (operand[0] == '@')
+		{
+			operand.remove_prefix(1);
+			if (!operand.empty() && operand[0] == '.') operand.remove_prefix(1);
+		}
+		size_t pos = 0;
+		while (pos < operand.size())
+		{
+			const size_t end = (std::min)(operand.find('.', pos), operand.size());
+			const std::string_view token = operand.substr(pos, end - pos);
+			if (token.empty()) return false;
+			Out_Predicate.path.emplace_back(std::string(token), ToIndex(token));
+			pos = end + 1;
+		}
+		if (opPos == std::string_view::npos) return true;
+
+		static constexpr std::pair<std::string_view, Compare> operators[] = {
+			{ "==", Compare::Equal }, { "!=", Compare::NotEqual }, { "<=", Compare::LessEqual },
+			{ ">=", Compare::GreaterEqual }, { "<", Compare::Less }, { ">", Compare::Greater } };
+		std::string_view rest = In_Text.substr(opPos);
+		Out_Predicate.compare = Compare::Exists;
+		for (const auto& op : operators)
+		{
+			if (rest.compare(0, op.first.size(), op.first) != 0) continue;
+			Out_Predicate.compare = op.second;
+			rest.remove_prefix(op.first.size());
+			break;
+		}
+		if (Out_Predicate.compare == Compare::Exists) return false;
+
+		const std::string_view literal = YAMLParser::UnquoteScalar(rest);
+		Out_Predicate.literal.assign(literal.data(), literal.size());
+		const auto [ptr, ec] = std::from_chars(literal.data(), literal.data() + literal.size(), Out_Predicate.number);
+		Out_Predicate.numeric = !literal.empty() && ec == std::errc() && ptr == literal.data() + literal.size();
+		return true;
+	}
+
+	std::vector<Step> m_Steps;
+	bool m_Valid = false;
+};
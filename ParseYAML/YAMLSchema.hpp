@@ -0,0 +1,575 @@
+#pragma once
+
+#include "YAMLParser.hpp"
+#include <tuple>
+#include <type_traits>
+
+/// <summary>
+/// \̂̃o[YAML̃L[ΉttB[hLqqłBʏ YAMLSCHEMA_FIELD Ő܂B
+/// </summary>
+template <class Owner, class Member>
+struct YAMLField
+{
+	std::string_view name;		// YAML̃L[
+	Member Owner::* member;		// Ή郁o[
+};
+
+template <class Owner, class Member>
+constexpr YAMLField<Owner, Member> MakeYAMLField(_In_ std::string_view In_Name, _In_ Member Owner::* In_Member) noexcept
+{
+	return { In_Name, In_Member };
+}
+
+// o[̂܂܃L[ƂtB[hLqq𐶐܂B: YAMLSCHEMA_FIELD(Record, id)
+#define YAMLSCHEMA_FIELD(Type, Member) MakeYAMLField(#Member, &Type::Member)
+
+/// <summary>
+/// \̂YAML̃}bv̑Ή`gCgłBΏۂ̍\̂ƂɓꉻAfields ɃtB[hLqq̃^v`܂B
+/// <code>
+/// template &lt;&gt; struct YAMLSchema&lt;Record&gt;
+/// {
+///     static constexpr auto fields = std::make_tuple(YAMLSCHEMA_FIELD(Record, id), YAMLSCHEMA_FIELD(Record, name));
+/// };
+/// </code>
+/// o[ɂ boolAA_Astd::stringAYAMLSchema `\́Aт std::vector g܂B
+/// </summary>
+template <class T>
+struct YAMLSchema {};
+
+struct YAMLBindTarget;
+
+// ľ^Ƃ̃oCh(^֐e[u)BYȂ nullptr łB
+struct YAMLBindOps
+{
+	void (*assign)(void* Out_Object, std::string_view In_Value);							// XJ[󂯎^
+	bool (*field)(void* In_Object, std::string_view In_Key, YAMLBindTarget& Out_Target);	// YAMLSchema \
+	void* (*append)(void* In_Object);														// std::vector
+	const YAMLBindOps* element;															// std::vector ̗vf^
+};
+
+// oCh̃IuWFNgƂ̌^̑
+struct YAMLBindTarget
+{
+	void* object = nullptr;
+	const YAMLBindOps* ops = nullptr;
+};
+
+/// <summary>
+/// ^Ƃ̃oChƏo񋟂܂B̓XJ[^ŁAƂ̊ԂŌ^ɉĕϊ܂B
+/// </summary>
+template <class T, class = void>
+struct YAMLBindTraits
+{
+	static void Assign(void* Out_Object, std::string_view In_Value)
+	{
+		T& value = *static_cast<T*>(Out_Object);
+		const std::string_view text = YAMLParser::UnquoteScalar(In_Value);
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			value = (text == "true" || text == "True" || text == "1");
+		}
+		else if constexpr (std::is_arithmetic_v<T>)
+		{
+			// ϊɎsꍇ͒lύXȂ
+			std::from_chars(text.data(), text.data() + text.size(), value);
+		}
+		else if constexpr (std::is_same_v<T, std::string>)
+		{
+			value.assign(text.data(), text.size());
+		}
+		else
+		{
+			static_assert(sizeof(T) == 0, "YAMLSchema `ĂȂ^̓oChł܂");
+		}
+	}
+
+	/// <summary>
+	/// lXJ[̃CxgƂďo܂Bl SetInt  SetDouble Ɠ\LɂȂ܂B
+	/// Oɋ󔒂A܂͑Oオ΂ɂȂṕ̕Aǂݖ߂ƂɓlɂȂ悤pň݂͂܂B
+	/// s܂ޕ̓e`(|)ŏo܂B
+	/// </summary>
+	template <class Handler>
+	static void Write(_In_ const T& In_Value, _Inout_ Handler& In_Handler)
+	{
+		using MultilineType = YAMLParser::YAMLNode::MultilineType;
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			In_Handler.OnScalar(In_Value ? "true" : "false", MultilineType::None);
+		}
+		else if constexpr (std::is_integral_v<T>)
+		{
+			char buffer[32];
+			const auto result = std::to_chars(buffer, buffer + sizeof(buffer), In_Value);
+			In_Handler.OnScalar(std::string_view(buffer, static_cast<size_t>(result.ptr - buffer)), MultilineType::None);
+		}
+		else if constexpr (std::is_floating_point_v<T>)
+		{
+			// std::to_string ƓŒ菬_6B܂Ȃl͍ŒZ\Lɂ
+			char buffer[512];
+			auto result = std::to_chars(buffer, buffer + sizeof(buffer), In_Value, std::chars_format::fixed, 6);
+			if (result.ec != std::errc()) result = std::to_chars(buffer, buffer + sizeof(buffer), In_Value);
+			In_Handler.OnScalar(std::string_view(buffer, static_cast<size_t>(result.ptr - buffer)), MultilineType::None);
+		}
+		else if constexpr (std::is_same_v<T, std::string>)
+		{
+			if (In_Value.find('\n') != std::string::npos)
+				In_Handler.OnScalar(In_Value, MultilineType::Literal);
+			else if (YAMLParser::NeedsQuotes(In_Value))
+				In_Handler.OnScalar("\"" + In_Value + "\"", MultilineType::None);
+			else
+				In_Handler.OnScalar(In_Value, MultilineType::None);
+		}
+		else
+		{
+			static_assert(sizeof(T) == 0, "YAMLSchema `ĂȂ^͏o܂");
+		}
+	}
+
+	static constexpr YAMLBindOps ops = { &Assign, nullptr, nullptr, nullptr };
+};
+
+template <class T>
+struct YAMLBindTraits<std::vector<T>>
+{
+	static void* Append(void* In_Object)
+	{
+		return &static_cast<std::vector<T>*>(In_Object)->emplace_back();
+	}
+
+	template <class Handler>
+	static void Write(_In_ const std::vector<T>& In_Value, _Inout_ Handler& In_Handler)
+	{
+		In_Handler.OnSeqStart();
+		for (const auto& element : In_Value)
+			YAMLBindTraits<T>::Write(element, In_Handler);
+		In_Handler.OnSeqEnd();
+	}
+
+	static constexpr YAMLBindOps ops = { nullptr, nullptr, &Append, &YAMLBindTraits<T>::ops };
+};
+
+template <class T>
+struct YAMLBindTraits<T, std::void_t<decltype(YAMLSchema<T>::fields)>>
+{
+	// L[ɈvtB[hTBtB[h̕т̓RpCɓWJ
+	static bool Field(void* In_Object, std::string_view In_Key, YAMLBindTarget& Out_Target)
+	{
+		T& object = *static_cast<T*>(In_Object);
+		return std::apply([&](const auto&... In_Fields)
+			{
+				return ((In_Fields.name == In_Key &&
+					(Out_Target = Target(object.*In_Fields.member), true)) || ...);
+			}, YAMLSchema<T>::fields);
+	}
+
+	// tB[h`Ƀ}bvƂďo
+	template <class Handler>
+	static void Write(_In_ const T& In_Value, _Inout_ Handler& In_Handler)
+	{
+		In_Handler.OnMapStart();
+		std::apply([&](const auto&... In_Fields)
+			{
+				((In_Handler.OnKey(In_Fields.name), WriteMember(In_Value.*In_Fields.member, In_Handler)), ...);
+			}, YAMLSchema<T>::fields);
+		In_Handler.OnMapEnd();
+	}
+
+	static constexpr YAMLBindOps ops = { nullptr, &Field, nullptr, nullptr };
+
+private:
+	template <class Member>
+	static YAMLBindTarget Target(Member& In_Member) noexcept
+	{
+		return { &In_Member, &YAMLBindTraits<Member>::ops };
+	}
+
+	template <class Member, class Handler>
+	static void WriteMember(_In_ const Member& In_Member, _Inout_ Handler& In_Handler)
+	{
+		YAMLBindTraits<Member>::Write(In_Member, In_Handler);
+	}
+};
+
+/// <summary>
+/// p[XCxg YAMLSchema ɏ]č\̂֒ڏރnh[łBm[hc[͍\z܂B
+/// Œ蒷̃t[X^bNŏԂǗ邽߁ACxgɃoC_[gmۂ邱Ƃ͂܂B
+/// XL[}ɂȂL[^̍Ȃm[h͓ǂݔ΂܂B
+/// </summary>
+class YAMLSchemaBinder
+{
+public:
+	// ǐՂReĩlXg̏B[͓ǂݔ΂܂B
+	static constexpr size_t MaxDepth = 64;
+
+	template <class T>
+	explicit YAMLSchemaBinder(_Out_ T& Out_Value) noexcept : m_Root{ &Out_Value, &YAMLBindTraits<T>::ops } {}
+
+	/// <summary>
+	/// YAMLt@C̎w肳ꂽL[pX̃Tuc[Am[hc[\zɒl֓ǂݍ݂܂B
+	/// Tuc[܂̓L[pX̃}bvGCAX}[WL[܂ޏꍇ́AQƂm[hc[ǂݍ݂܂B
+	/// </summary>
+	/// <param name="In_FilePath">ǂݍYAMLt@C̃pXB</param>
+	/// <param name="Out_Value">ǂݍݐBYAMLɂȂo[͕ύX܂B</param>
+	/// <param name="In_KeyPath">ǂݍރTuc[̃hbg؂pXB̏ꍇ̓hLgŚB</param>
+	/// <returns>t@Cǂݍ߁AL[pX݂ꍇ true Ԃ܂B</returns>
+	template <class T>
+	static bool BindFile(_In_ const std::string& In_FilePath, _Out_ T& Out_Value, _In_ std::string_view In_KeyPath = "");
+
+	/// <summary>
+	/// \zς݂̃m[hl֓ǂݍ݂܂B
+	/// </summary>
+	/// <param name="In_Node">ǂݍރm[hB</param>
+	/// <param name="Out_Value">ǂݍݐBm[hɂȂo[͕ύX܂B</param>
+	template <class T>
+	static void BindNode(_In_ const YAMLParser::YAMLNode& In_Node, _Out_ T& Out_Value)
+	{
+		YAMLSchemaBinder binder(Out_Value);
+		YAMLParser::EmitEvents(In_Node, binder);
+	}
+
+	// ǂݍݐɒl蓖Ăꂽǂ
+	inline bool IsBound() const noexcept { return m_Bound; }
+
+	void OnMapStart() { Open(&YAMLBindOps::field); }
+	void OnSeqStart() { Open(&YAMLBindOps::append); }
+	void OnMapEnd() { Close(); }
+	void OnSeqEnd() { Close(); }
+
+	void OnKey(_In_ std::string_view In_Key)
+	{
+		if (m_SkipDepth > 0 || m_Depth == 0) return;
+		const YAMLBindTarget& top = m_Stack[m_Depth - 1];
+		m_Pending = YAMLBindTarget{};
+		if (top.ops->field) top.ops->field(top.object, In_Key, m_Pending);
+	}
+
+	void OnScalar(_In_ std::string_view In_Value, _In_ YAMLParser::YAMLNode::MultilineType)
+	{
+		if (m_SkipDepth > 0) return;
+		const YAMLBindTarget target = TakeTarget(&YAMLBindOps::assign);
+		if (target.object) target.ops->assign(target.object, In_Value);
+	}
+
+	// GCAX̎QƐ̃Cxg͍ĐȂ߁Alǂݔ΂(BindFile ̓m[hc[ǂݍݒ)
+	void OnAnchor(_In_ std::string_view) noexcept {}
+	void OnAlias(_In_ std::string_view) noexcept { m_Pending = YAMLBindTarget{}; }
+
+private:
+
+	/// <summary>
+	/// ̒l̏ݐo܂Bݐ̌^w肳ꂽȂꍇ͋Ԃ܂B
+	/// V[PX̒ł́A^ꍇɌvfǉĂԂ܂B
+	/// </summary>
+	template <class Operation>
+	YAMLBindTarget TakeTarget(_In_ Operation YAMLBindOps::* In_Required)
+	{
+		YAMLBindTarget target;
+		if (m_Depth == 0)
+		{
+			target = m_Root;
+			m_Bound = true;
+		}
+		else
+		{
+			const YAMLBindTarget& top = m_Stack[m_Depth - 1];
+			if (top.ops->append)
+			{
+				if (top.ops->element->*In_Required)
+					target = { top.ops->append(top.object), top.ops->element };
+			}
+			else
+			{
+				target = m_Pending;
+				m_Pending = YAMLBindTarget{};
+			}
+		}
+		if (!target.object || !(target.ops->*In_Required)) return YAMLBindTarget{};
+		return target;
+	}
+
+	template <class Operation>
+	void Open(_In_ Operation YAMLBindOps::* In_Required)
+	{
+		if (m_SkipDepth > 0)
+		{
+			++m_SkipDepth;
+			return;
+		}
+		const YAMLBindTarget target = TakeTarget(In_Required);
+		if (!target.object || m_Depth == MaxDepth)
+		{
+			m_SkipDepth = 1;
+			return;
+		}
+		m_Stack[m_Depth++] = target;
+	}
+
+	void Close() noexcept
+	{
+		if (m_SkipDepth > 0) --m_SkipDepth;
+		else if (m_Depth > 0) --m_Depth;
+	}
+
+	YAMLBindTarget m_Root;					// ŏʂ̒l̏ݐ
+	YAMLBindTarget m_Stack[MaxDepth];		// JĂReȉݐ
+	size_t m_Depth = 0;
+	size_t m_SkipDepth = 0;					// ǂݔ΂̃ReĩlXg
+	YAMLBindTarget m_Pending;				// ÕL[ɑΉ郁o[
+	bool m_Bound = false;
+};
+
+/// <summary>
+/// p[XCxĝAw肳ꂽL[pX̃Tuc[Ɋ܂܂̂ʂ̃nh[֓]܂B
+/// L[pX̊evf̓}bṽL[A܂̓V[PX̓YłBL[pX̓̕tB^[蒷ێĂB
+/// </summary>
+template <class Handler>
+class YAMLSubtreeFilter
+{
+public:
+	YAMLSubtreeFilter(_Inout_ Handler& In_Handler, _In_ std::string_view In_KeyPath) : m_Handler(In_Handler)
+	{
+		size_t pos = 0;
+		while (!In_KeyPath.empty() && pos <= In_KeyPath.size())
+		{
+			const size_t next = (std::min)(In_KeyPath.find('.', pos), In_KeyPath.size());
+			const std::string_view token = In_KeyPath.substr(pos, next - pos);
+			size_t index = SIZE_MAX;
+			const auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), index);
+			if (ec != std::errc() || ptr != token.data() + token.size()) index = SIZE_MAX;
+			m_Tokens.push_back({ token, index });
+			pos = next + 1;
+		}
+		m_Levels.reserve(m_Tokens.size());
+	}
+
+	// Tuc[̐擪]ǂ
+	inline bool IsMatched() const noexcept { return m_Matched; }
+
+	// Tuc[܂̓L[pX̃}bvɃGCAX}[WL[A]Cxgł͓eȂǂ
+	inline bool HasUnresolvedAlias() const noexcept { return m_Unresolved; }
+
+	void OnMapStart() { Start(true); }
+	void OnSeqStart() { Start(false); }
+	void OnMapEnd() { End(true); }
+	void OnSeqEnd() { End(false); }
+
+	void OnKey(_In_ std::string_view In_Key)
+	{
+		if (m_Forward > 0)
+		{
+			m_Handler.OnKey(In_Key);
+			return;
+		}
+		if (m_Skip > 0 || m_Levels.empty()) return;
+		m_KeyMatched = (In_Key == m_Tokens[m_Levels.size() - 1].key);
+		m_MergeKey = (In_Key == "<<");
+	}
+
+	void OnScalar(_In_ std::string_view In_Value, _In_ YAMLParser::YAMLNode::MultilineType In_MultilineType)
+	{
+		if (m_Forward == 0)
+		{
+			if (m_Skip > 0 || MatchValue() != Match::Target) return;
+			m_Matched = true;
+		}
+		m_Handler.OnScalar(In_Value, In_MultilineType);
+	}
+
+	void OnAnchor(_In_ std::string_view In_Name)
+	{
+		if (m_Forward > 0) m_Handler.OnAnchor(In_Name);
+	}
+
+	void OnAlias(_In_ std::string_view In_Name)
+	{
+		if (m_Forward == 0)
+		{
+			if (m_Skip > 0) return;
+			const bool mergeKey = m_MergeKey;
+			const Match match = MatchValue();
+			// L[pX̃}bvւ̃}[W̓L[pX̗̐vf𑝂₵
+			if (match == Match::None && !mergeKey) return;
+			m_Unresolved = true;
+			if (match != Match::Target) return;
+			m_Matched = true;
+		}
+		m_Unresolved = true;
+		m_Handler.OnAlias(In_Name);
+	}
+
+private:
+
+	enum class Match
+	{
+		None,		// L[pXOĂ
+		OnPath,		// L[pX̓r
+		Target		// L[pXwTuc[
+	};
+
+	struct Token
+	{
+		std::string_view key;
+		size_t index;		// YƂĉ߂łȂꍇ SIZE_MAX
+	};
+
+	struct Level
+	{
+		bool isMap;
+		size_t nextIndex;	// V[PX̏ꍇA̗vf̓Y
+	};
+
+	// ̒lL[pX̂ǂɓ邩𔻒肷
+	Match MatchValue()
+	{
+		if (m_Levels.empty()) return m_Tokens.empty() ? Match::Target : Match::OnPath;
+
+		Level& level = m_Levels.back();
+		const size_t depth = m_Levels.size() - 1;
+		bool matched = false;
+		if (level.isMap)
+		{
+			matched = m_KeyMatched;
+			m_KeyMatched = false;
+			m_MergeKey = false;
+		}
+		else
+		{
+			matched = (level.nextIndex++ == m_Tokens[depth].index);
+		}
+		if (!matched) return Match::None;
+		return (depth + 1 == m_Tokens.size()) ? Match::Target : Match::OnPath;
+	}
+
+	void Start(_In_ const bool& In_IsMap)
+	{
+		if (m_Forward == 0)
+		{
+			if (m_Skip > 0)
+			{
+				++m_Skip;
+				return;
+			}
+			if (m_MergeKey) m_Unresolved = true;	// "<<: [*a, *b]"
+			switch (MatchValue())
+			{
+			case Match::Target:
+				m_Matched = true;
+				break;
+			case Match::OnPath:
+				m_Levels.push_back({ In_IsMap, 0 });
+				return;
+			default:
+				m_Skip = 1;
+				return;
+			}
+		}
+		++m_Forward;
+		if (In_IsMap) m_Handler.OnMapStart();
+		else m_Handler.OnSeqStart();
+	}
+
+	void End(_In_ const bool& In_IsMap)
+	{
+		if (m_Forward > 0)
+		{
+			--m_Forward;
+			if (In_IsMap) m_Handler.OnMapEnd();
+			else m_Handler.OnSeqEnd();
+		}
+		else if (m_Skip > 0)
+		{
+			--m_Skip;
+		}
+		else if (!m_Levels.empty())
+		{
+			m_Levels.pop_back();
+		}
+	}
+
+	Handler& m_Handler;
+	std::vector<Token> m_Tokens;
+	std::vector<Level> m_Levels;	// L[pXŊJĂRei
+	size_t m_Forward = 0;			// ]̃ReĩlXg
+	size_t m_Skip = 0;				// ǂݔ΂̃ReĩlXg
+	bool m_KeyMatched = false;		// ÕL[L[pXɈvǂ
+	bool m_MergeKey = false;		// ÕL[}[WL[(<<)ǂ
+	bool m_Matched = false;
+	bool m_Unresolved = false;
+};
+
+template <class T>
+bool YAMLSchemaBinder::BindFile(_In_ const std::string& In_FilePath, _Out_ T& Out_Value, _In_ std::string_view In_KeyPath)
+{
+	// GCAXꍇɓǂݍݒ悤AǂݍݑO̒lɑ΂ēǂݍ
+	T value = Out_Value;
+	YAMLSchemaBinder binder(value);
+	YAMLSubtreeFilter<YAMLSchemaBinder> filter(binder, In_KeyPath);
+	if (!YAMLParser::ParseEvents(In_FilePath, filter)) return false;
+	if (!filter.HasUnresolvedAlias())
+	{
+		if (!filter.IsMatched()) return false;
+		Out_Value = std::move(value);
+		return true;
+	}
+
+	YAMLParser parser;
+	if (!parser.ParseYAML(In_FilePath)) return false;
+	if (In_KeyPath.empty())
+	{
+		BindNode(parser.GetYAMLData(), Out_Value);
+		return true;
+	}
+	const std::shared_ptr<YAMLParser::YAMLNode> node = parser.GetNodeByPath(std::string(In_KeyPath));
+	if (!node) return false;
+	BindNode(*node, Out_Value);
+	return true;
+}
+
+/// <summary>
+/// YAMLSchema ɏ]č\̂ReiAm[hc[\zɒYAMLƂďo܂B
+///  SaveYAML ƓłBParseYAML œǂݍ߂hLgɂɂ́Aŏʂ\̂ɂĂB
+/// </summary>
+class YAMLSchemaWriter
+{
+public:
+	/// <summary>
+	/// lCxgƂănh[ɒʒm܂B\̂̃tB[h YAMLSchema ̒`ɒʒm܂B
+	/// </summary>
+	template <class T, class Handler>
+	static void WriteEvents(_In_ const T& In_Value, _Inout_ Handler&& In_Handler)
+	{
+		YAMLBindTraits<T>::Write(In_Value, In_Handler);
+	}
+
+	/// <summary>
+	/// lYAMLƂăXg[֏o܂B
+	/// </summary>
+	/// <param name="Out_OStream">õXg[B</param>
+	/// <param name="In_Value">olB</param>
+	template <class T>
+	static void Write(_Inout_ std::ostream& Out_OStream, _In_ const T& In_Value)
+	{
+		WriteEvents(In_Value, YAMLParser::YAMLEmitter(Out_OStream));
+	}
+
+	/// <summary>
+	/// lYAMLt@CƂĕۑ܂B
+	/// </summary>
+	/// <param name="In_FilePath">ۑ̃t@CpXB</param>
+	/// <param name="In_Value">ۑlB</param>
+	/// <returns>ۑɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	template <class T>
+	static bool SaveFile(_In_ const std::string& In_FilePath, _In_ const T& In_Value)
+	{
+		std::ofstream ofs;
+		if (!YAMLParser::OpenOutputFile(In_FilePath, ofs)) return false;
+
+		Write(ofs, In_Value);
+		if (!ofs)
+		{
+			YAMLParser::Log(YAMLParser::LogLevel::Error, "t@C݃G[: " + In_FilePath);
+			return false;
+		}
+		return true;
+	}
+};
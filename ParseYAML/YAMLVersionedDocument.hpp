@@ -0,0 +1,165 @@
+#pragma once
+
+#include "YAMLParser.hpp"
+#include <deque>
+
+/// <summary>
+/// ύX̂тɕsς̔łAƂĕێYAMLhLgłB
+/// Vł͒O̔łƃm[hLAύXpX̃m[h𕡐邽߁A
+/// 1ł̃RXg̓hLgŜł͂ȂύXpX̒(ƊeKw̗vf)ɔႵ܂B
+/// ɖ߂E蒼Aʂ̐ݒɑ΂郊NGXgPʂ̏㏑Ɏg܂B
+/// </summary>
+class YAMLVersionedDocument
+{
+public:
+	using Version = std::shared_ptr<const YAMLParser>;
+
+	YAMLVersionedDocument() : YAMLVersionedDocument(YAMLParser{}) {}
+	explicit YAMLVersionedDocument(_In_ const YAMLParser& In_Initial)
+	{
+		m_Versions.push_back(std::make_shared<const YAMLParser>(In_Initial.Fork()));
+	}
+
+	/// <summary>
+	/// w肳ꂽłɁA֐ŕύXVł쐬܂Bɂ͋L^܂B
+	/// </summary>
+	/// <param name="In_Base">ɂȂŁB</param>
+	/// <param name="In_Mutator">YAMLParser&amp; 󂯎Abool ԂύX֐B</param>
+	/// <returns>쐬ŁBύX֐ false Ԃꍇ nullptr Ԃ܂B</returns>
+	template <class Mutator>
+	static Version Derive(_In_ const Version& In_Base, _In_ Mutator&& In_Mutator)
+	{
+		if (!In_Base) return nullptr;
+		auto next = std::make_shared<YAMLParser>(In_Base->Fork());
+		if (!In_Mutator(*next)) return nullptr;
+		return next;
+	}
+
+	/// <summary>
+	/// YAMLt@Cǂݍ݁AVłƂėɒǉ܂B
+	/// </summary>
+	/// <param name="In_FilePath">ǂݍYAMLt@C̃pXB</param>
+	/// <returns>ǂݍ݂ɐꍇ trueAsꍇ false Ԃ܂B</returns>
+	bool ParseYAML(_In_ const std::string& In_FilePath)
+	{
+		auto parser = std::make_shared<YAMLParser>();
+		if (!parser->ParseYAML(In_FilePath)) return false;
+		Commit(std::move(parser));
+		return true;
+	}
+
+	/// <summary>
+	/// ݂̔łɊ֐ŕύXVłAɒǉ܂B蒼p̗͔j܂B
+	/// </summary>
+	/// <param name="In_Mutator">YAMLParser&amp; 󂯎Abool ԂύX֐Bfalse Ԃꍇ͔łǉ܂B</param>
+	/// <returns>łǉꍇ trueAꍇ false Ԃ܂B</returns>
+	template <class Mutator>
+	bool Edit(_In_ Mutator&& In_Mutator)
+	{
+		Version next = Derive(Current(), std::forward<Mutator>(In_Mutator));
+		if (!next) return false;
+		Commit(std::move(next));
+		return true;
+	}
+
+	inline bool SetString(_In_ const std::string& In_keyPath, _In_ const std::string& In_Value)
+	{
+		return Edit([&](YAMLParser& In_Parser) { return In_Parser.SetString(In_keyPath, In_Value); });
+	}
+	inline bool SetBool(_In_ const std::string& In_keyPath, _In_ const bool& In_Value)
+	{
+		return Edit([&](YAMLParser& In_Parser) { return In_Parser.SetBool(In_keyPath, In_Value); });
+	}
+	inline bool SetInt(_In_ const std::string& In_keyPath, _In_ const int& In_Value)
+	{
+		return Edit([&](YAMLParser& In_Parser) { return In_Parser.SetInt(In_keyPath, In_Value); });
+	}
+	inline bool SetFloat(_In_ const std::string& In_keyPath, _In_ const float& In_Value)
+	{
+		return Edit([&](YAMLParser& In_Parser) { return In_Parser.SetFloat(In_keyPath, In_Value); });
+	}
+	inline bool SetDouble(_In_ const std::string& In_keyPath, _In_ const double& In_Value)
+	{
+		return Edit([&](YAMLParser& In_Parser) { return In_Parser.SetDouble(In_keyPath, In_Value); });
+	}
+	inline bool GenerateNode(_In_ const std::string& In_keyPath, _In_ const YAMLParser::YAMLNode::Type& In_Type,
+		_In_ const YAMLParser::YAMLNode::MultilineType& In_MultilineType = YAMLParser::YAMLNode::MultilineType::None)
+	{
+		return Edit([&](YAMLParser& In_Parser) { In_Parser.GenerateNode(In_keyPath, In_Type, In_MultilineType); return true; });
+	}
+
+	/// <summary>
+	/// ݂̔ł擾܂B擾ł͈ȍ~̕ύX◚̔j̉e󂯂܂B
+	/// </summary>
+	inline const Version& Current() const noexcept { return m_Versions[m_CurrentIndex]; }
+
+	/// <summary>
+	/// 1O̔łɖ߂܂B
+	/// </summary>
+	/// <returns>߂ꍇ trueAłÂł̏ꍇ false Ԃ܂B</returns>
+	inline bool Undo() noexcept
+	{
+		if (m_CurrentIndex == 0) return false;
+		--m_CurrentIndex;
+		return true;
+	}
+
+	/// <summary>
+	/// Undo Ŗ߂ł1i߂܂B
+	/// </summary>
+	/// <returns>i߂ꂽꍇ trueAŐV̔ł̏ꍇ false Ԃ܂B</returns>
+	inline bool Redo() noexcept
+	{
+		if (m_CurrentIndex + 1 >= m_Versions.size()) return false;
+		++m_CurrentIndex;
+		return true;
+	}
+
+	/// <summary>
+	/// ɕێĂł̐擾܂B
+	/// </summary>
+	inline size_t GetVersionCount() const noexcept { return m_Versions.size(); }
+
+	/// <summary>
+	/// ̎wʒu̔ł擾܂B0 łÂłłB
+	/// </summary>
+	/// <param name="In_Index">擾ł̈ʒuB</param>
+	/// <returns>wʒu̔ŁB͈͊Ȍꍇ nullptr Ԃ܂B</returns>
+	inline Version GetVersion(_In_ const size_t& In_Index) const
+	{
+		return (In_Index < m_Versions.size()) ? m_Versions[In_Index] : nullptr;
+	}
+
+	/// <summary>
+	/// ێł̍ő吔ݒ肵܂Bꍇ͌Âłj܂B
+	/// </summary>
+	/// <param name="In_Limit">ێł̍ő吔(1ȏ)B</param>
+	void SetHistoryLimit(_In_ const size_t& In_Limit)
+	{
+		m_HistoryLimit = (std::max)(In_Limit, static_cast<size_t>(1));
+		TrimHistory();
+	}
+
+private:
+
+	void Commit(_In_ Version In_Next)
+	{
+		m_Versions.erase(m_Versions.begin() + m_CurrentIndex + 1, m_Versions.end());
+		m_Versions.push_back(std::move(In_Next));
+		m_CurrentIndex = m_Versions.size() - 1;
+		TrimHistory();
+	}
+
+	void TrimHistory()
+	{
+		while (m_Versions.size() > m_HistoryLimit)
+		{
+			m_Versions.pop_front();
+			if (m_CurrentIndex > 0) --m_CurrentIndex;
+		}
+	}
+
+	std::deque<Version> m_Versions;	// Âɕ񂾔ł̗
+	size_t m_CurrentIndex = 0;
+	size_t m_HistoryLimit = SIZE_MAX;
+};
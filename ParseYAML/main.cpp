@@ -1,7 +1,30 @@
 ﻿#include "YAMLParser.hpp"
+#include "YAMLConcurrentDocument.hpp"
+#include "YAMLDocumentCache.hpp"
+#include "YAMLDocumentStream.hpp"
+#include "YAMLJSON.hpp"
+#include "YAMLLayeredDocument.hpp"
+#include "YAMLQuery.hpp"
+#include "YAMLSchema.hpp"
+#include "YAMLVersionedDocument.hpp"
+#include <chrono>
 #include <crtdbg.h>
 #include <iostream>
 
+// 構造体への読み込みと書き出しの確認に使う構造体
+struct SchemaTestRecord
+{
+	std::string name;
+	int port = 0;
+	std::vector<int> ids;
+};
+
+template <>
+struct YAMLSchema<SchemaTestRecord>
+{
+	static constexpr auto fields = std::make_tuple(YAMLSCHEMA_FIELD(SchemaTestRecord, name), YAMLSCHEMA_FIELD(SchemaTestRecord, port), YAMLSCHEMA_FIELD(SchemaTestRecord, ids));
+};
+
 int main()
 {
 	// メモリリーク検出
@@ -38,6 +61,281 @@ int main()
 
 	yaml->SaveYAML("OutputTestData.yaml");
 
+	// 書式を保った保存を同じファイルに繰り返しても、値の位置がずれないことを確認
+	{
+		const char* path = "InPlaceSaveTestData.yaml";
+		{
+			std::ofstream ofs(path, std::ios::binary);
+			ofs << "port: 1\nlist: x\n";
+		}
+		YAMLParser edited;
+		edited.EnableSourceSpans();
+		bool ok = edited.ParseYAML(path);
+		for (const char* value : { "", "7", "8" })
+			ok = ok && edited.SetString("port", value) && edited.SaveChanges(path);
+		YAMLParser reloaded;
+		ok = ok && reloaded.ParseYAML(path) && reloaded.GetInt("port") == 8 && reloaded.GetString("list") == "x";
+		std::cout << "書式を保った保存の繰り返し: " << (ok ? "OK" : "NG") << std::endl;
+		std::filesystem::remove(path);
+	}
+
+	// YAMLの構文と紛れる文字列の値を保存して読み直しても、同じ文字列として読めることを確認
+	{
+		const char* path = "QuotedScalarTestData.yaml";
+		const char* values[] = { "[a, b]", "{k: v}", "&anc value", "*.txt", "!tag", "| x", "> x", "# x", "%x", "@x",
+			"- item", "? q", ": v", "key: value", "a #b", "ends:", " edge ", "say \"hi\"" };
+		YAMLParser written;
+		written.GenerateNode("list", YAMLParser::YAMLNode::Type::Sequence);
+		for (size_t i = 0; i < std::size(values); ++i)
+		{
+			written.SetString("v" + std::to_string(i), values[i]);
+			written.GenerateNode("list." + std::to_string(i), YAMLParser::YAMLNode::Type::Scalar);
+			written.SetString("list." + std::to_string(i), values[i]);
+		}
+		YAMLParser reloaded;
+		bool ok = written.SaveYAML(path) && reloaded.ParseYAML(path);
+		for (size_t i = 0; i < std::size(values); ++i)
+			ok = ok && reloaded.GetString("v" + std::to_string(i)) == values[i] && reloaded.GetString("list." + std::to_string(i)) == values[i];
+		std::cout << "構文と紛れる値の保存と再読み込み: " << (ok ? "OK" : "NG") << std::endl;
+		std::filesystem::remove(path);
+	}
+
+	// アンカーやエイリアスと紛れる値にアンカーを付けて書き出しても、エイリアスから同じ文字列として読めることを確認
+	{
+		std::ostringstream out;
+		YAMLParser::YAMLEmitter emitter(out, YAMLParser::YAMLSaveOptions());
+		emitter.OnMapStart();
+		emitter.OnKey("pattern");
+		emitter.OnAnchor("p");
+		emitter.OnScalar("*.txt", YAMLParser::YAMLNode::MultilineType::None);
+		emitter.OnKey("copy");
+		emitter.OnAlias("p");
+		emitter.OnKey("label");
+		emitter.OnScalar("&anc value", YAMLParser::YAMLNode::MultilineType::None);
+		emitter.OnMapEnd();
+		YAMLParser reloaded;
+		const bool ok = reloaded.ParseYAMLBuffer(out.str()) && reloaded.GetString("copy") == "*.txt" && reloaded.GetString("label") == "&anc value";
+		std::cout << "アンカー付きの紛らわしい値の書き出し: " << (ok ? "OK" : "NG") << std::endl;
+	}
+
+	// 閉じない括弧が段々に深くなる入力でも、入れ子の括弧ごとに後続の行を読み直さず短時間で読み終えることを確認
+	{
+		std::string text;
+		const size_t depth = 500;
+		for (size_t i = 0; i < depth; ++i)
+			text += std::string(i, ' ') + "k: [\n";
+		for (size_t i = 0; i < 1000; ++i)
+			text += std::string(depth + 1, ' ') + "x,\n";
+		YAMLParser staircase;
+		const auto start = std::chrono::steady_clock::now();
+		const bool parsed = staircase.ParseYAMLBuffer(text);
+		const bool ok = parsed && std::chrono::steady_clock::now() - start < std::chrono::seconds(1);
+		std::cout << "閉じない括弧の段々の読み込み: " << (ok ? "OK" : "NG") << std::endl;
+	}
+
+	// パスの索引を有効にしても、索引のない検索と同じ値が得られ、追加と削除が索引に反映されることを確認
+	{
+		YAMLParser indexed;
+		bool ok = indexed.ParseYAMLBuffer("server:\n  host: example\n  ports: [80, 443]\n");
+		indexed.EnablePathIndex();
+		ok = ok && indexed.GetString("server.host") == "example" && indexed.GetInt("server.ports.1") == 443;
+		ok = ok && indexed.SetInt("server.timeout", 30) && indexed.GetInt("server.timeout") == 30;
+		indexed.EnablePathIndex(false);
+		ok = ok && indexed.GetInt("server.timeout") == 30;
+		std::cout << "パスの索引による検索: " << (ok ? "OK" : "NG") << std::endl;
+	}
+
+	// スナップショットに保存して読み直しても、同じ内容として読めることを確認
+	{
+		const char* path = "SnapshotTestData.bin";
+		YAMLParser original;
+		bool ok = original.ParseYAMLBuffer("name: snapshot\nlist:\n  - a\n  - b\nnested:\n  value: 1.5\n");
+		YAMLParser restored;
+		ok = ok && original.SaveBinary(path) && restored.LoadBinary(path);
+		ok = ok && restored.IsSameContent(original) && restored.GetString("list.1") == "b" && restored.GetDouble("nested.value") == 1.5;
+		std::cout << "スナップショットの保存と読み込み: " << (ok ? "OK" : "NG") << std::endl;
+		std::filesystem::remove(path);
+	}
+
+	// 同じファイルの2回目の読み込みはキャッシュした文書を返し、無効化した後は読み直すことを確認
+	{
+		const char* path = "CacheTestData.yaml";
+		{
+			std::ofstream ofs(path, std::ios::binary);
+			ofs << "value: 1\n";
+		}
+		YAMLDocumentCache& cache = YAMLDocumentCache::Instance();
+		const YAMLDocumentCache::Document first = cache.Get(path);
+		const YAMLDocumentCache::Document second = cache.Get(path);
+		bool ok = first && first == second && first->GetInt("value") == 1;
+		cache.Invalidate(path);
+		const YAMLDocumentCache::Document reloaded = cache.Get(path);
+		ok = ok && reloaded && reloaded != first && reloaded->GetInt("value") == 1;
+		cache.Clear();
+		std::cout << "文書のキャッシュ: " << (ok ? "OK" : "NG") << std::endl;
+		std::filesystem::remove(path);
+	}
+
+	// 更新しても、更新前に取得したスナップショットは以前の値を保つことを確認
+	{
+		YAMLParser initial;
+		initial.ParseYAMLBuffer("port: 1\n");
+		YAMLConcurrentDocument document(std::move(initial));
+		const YAMLConcurrentDocument::Snapshot before = document.GetSnapshot();
+		bool ok = document.SetInt("port", 2) && document.GetInt("port") == 2 && before->GetInt("port") == 1;
+		ok = ok && !document.Update([](YAMLParser& In_Parser) { In_Parser.SetInt("port", 3); return false; }) && document.GetInt("port") == 2;
+		std::cout << "並行読み取り用の文書の更新: " << (ok ? "OK" : "NG") << std::endl;
+	}
+
+	// 版を重ねた文書で、元に戻す・やり直すと各版の値に戻ることを確認
+	{
+		YAMLParser initial;
+		initial.ParseYAMLBuffer("level: 1\nname: v\n");
+		YAMLVersionedDocument versions(initial);
+		bool ok = versions.SetInt("level", 2) && versions.SetInt("level", 3) && versions.GetVersionCount() == 3;
+		ok = ok && versions.Undo() && versions.Current()->GetInt("level") == 2;
+		ok = ok && versions.Undo() && versions.Current()->GetInt("level") == 1 && !versions.Undo();
+		ok = ok && versions.Redo() && versions.Current()->GetInt("level") == 2 && versions.GetVersion(2)->GetInt("level") == 3;
+		std::cout << "版の履歴と元に戻す操作: " << (ok ? "OK" : "NG") << std::endl;
+	}
+
+	// 構造体へ直接読み込み、構造体から書き出したものを読み直して同じ値になることを確認
+	{
+		const char* path = "SchemaTestData.yaml";
+		SchemaTestRecord written{ "host: name", 8080, { 1, 2, 3 } };
+		SchemaTestRecord bound;
+		bool ok = YAMLSchemaWriter::SaveFile(path, written) && YAMLSchemaBinder::BindFile(path, bound);
+		ok = ok && bound.name == written.name && bound.port == written.port && bound.ids == written.ids;
+		std::cout << "構造体への読み込みと書き出し: " << (ok ? "OK" : "NG") << std::endl;
+		std::filesystem::remove(path);
+	}
+
+	// フロー形式のコレクションが、複数行にまたがるものも含めてノードとして読めることを確認
+	{
+		YAMLParser flow;
+		bool ok = flow.ParseYAMLBuffer("matrix: [[1, 2], [3, 4]]\nobj: {a: 1, b: \"x, y\", c: [true, false]}\nmulti: [\n  10, 20, # comment ]\n  30\n]\nafter: ok\n");
+		ok = ok && flow.GetInt("matrix.1.0") == 3 && flow.GetString("obj.b") == "x, y" && !flow.GetBool("obj.c.1");
+		ok = ok && flow.GetInt("multi.2") == 30 && flow.GetString("after") == "ok";
+		std::cout << "フロー形式のコレクションの読み込み: " << (ok ? "OK" : "NG") << std::endl;
+	}
+
+	// 長い数値のシーケンスを詰めた配列として保持しても、要素を数値として取得できることを確認
+	{
+		YAMLParser dense;
+		dense.SetDenseArrayThreshold(4);
+		bool ok = dense.ParseYAMLBuffer("samples: [1, 2, 3, 4, 5, 6]\nsmall: [1, 2]\n");
+		ok = ok && dense.GetInt("samples.5") == 6 && dense.GetString("samples.0") == "1" && dense.GetInt("small.1") == 2;
+		std::cout << "数値配列の読み込み: " << (ok ? "OK" : "NG") << std::endl;
+	}
+
+	// アンカー・エイリアス・マージキーが解決され、解決できないエイリアスは診断に記録されることを確認
+	{
+		YAMLParser anchors;
+		bool ok = anchors.ParseYAMLBuffer("base: &b\n  x: 1\n  y: 2\nderived:\n  <<: *b\n  y: 3\nref: *b\n");
+		ok = ok && anchors.GetInt("derived.x") == 1 && anchors.GetInt("derived.y") == 3 && anchors.GetInt("ref.y") == 2;
+		YAMLParser missing;
+		ok = ok && missing.ParseYAMLBuffer("a: 1\nb: *nothing\n") && missing.GetDiagnostics().size() == 1 && missing.GetDiagnostics()[0].line == 2;
+		std::cout << "アンカーとマージキーの解決: " << (ok ? "OK" : "NG") << std::endl;
+	}
+
+	// ファイル内の各ドキュメントを番号を指定して個別に読み込めることを確認
+	{
+		const char* path = "StreamTestData.yaml";
+		{
+			std::ofstream ofs(path, std::ios::binary);
+			ofs << "\xEF\xBB\xBF---\nid: 0\n---\nid: 1\n...\n---   id: 2\n";
+		}
+		YAMLDocumentStream stream;
+		YAMLParser document;
+		bool ok = stream.Open(path) && stream.GetDocumentCount() == 3;
+		for (size_t i = 0; ok && i < stream.GetDocumentCount(); ++i)
+			ok = stream.ParseDocument(i, document) && document.GetInt("id") == static_cast<int>(i);
+		std::cout << "複数ドキュメントのファイルの読み込み: " << (ok ? "OK" : "NG") << std::endl;
+		std::filesystem::remove(path);
+	}
+
+	// ワイルドカードと条件を含む問い合わせで、一致するノードだけが得られることを確認
+	{
+		YAMLParser records;
+		records.ParseYAMLBuffer("records:\n  - name: a\n    value: 5\n  - name: b\n    value: 20\n  - name: c\n    value: 30\n");
+		const std::vector<YAMLNodeView> matched = YAMLQuery("records[?value > 10].name").Evaluate(records);
+		const bool ok = matched.size() == 2 && matched[0].GetString() == "b" && matched[1].GetString() == "c" &&
+			YAMLQuery("records.*.value").Evaluate(records).size() == 3;
+		std::cout << "問い合わせの評価: " << (ok ? "OK" : "NG") << std::endl;
+	}
+
+	// 上限を超える入力はパースを打ち切り、以前のデータを保つことを確認
+	{
+		YAMLParser limited;
+		limited.ParseYAMLBuffer("kept: 1\n");
+		YAMLParser::YAMLParseLimits limits;
+		limits.maxDepth = 3;
+		limits.maxScalarLength = 8;
+		limited.SetParseLimits(limits);
+		bool ok = !limited.ParseYAMLBuffer("a:\n  b:\n    c:\n      d: 1\n") && limited.GetInt("kept") == 1;
+		ok = ok && !limited.ParseYAMLBuffer("a: 123456789\n") && limited.ParseYAMLBuffer("a:\n  b: 12345678\n");
+		std::cout << "パースの上限: " << (ok ? "OK" : "NG") << std::endl;
+	}
+
+	// 内容のハッシュはキーの順序によらず、差分は変更のあったパスだけを返すことを確認
+	{
+		YAMLParser before;
+		YAMLParser reordered;
+		YAMLParser after;
+		bool ok = before.ParseYAMLBuffer("a: 1\nb:\n  c: 2\n  d: 3\n") && reordered.ParseYAMLBuffer("b:\n  d: 3\n  c: 2\na: 1\n") &&
+			after.ParseYAMLBuffer("a: 1\nb:\n  c: 4\n  d: 3\ne: 5\n");
+		ok = ok && before.IsSameContent(reordered) && before.Diff(reordered).empty() && !before.IsSameContent(after);
+		const std::vector<YAMLParser::YAMLChange> changes = before.Diff(after);
+		ok = ok && changes.size() == 2;
+		for (const auto& change : changes)
+			ok = ok && ((change.kind == YAMLParser::YAMLChange::Kind::Changed && change.path == "b.c") || (change.kind == YAMLParser::YAMLChange::Kind::Added && change.path == "e"));
+		std::cout << "内容のハッシュと差分: " << (ok ? "OK" : "NG") << std::endl;
+	}
+
+	// 上のレイヤーの値が優先され、マージした文書は元のレイヤーを破棄しても使えることを確認
+	{
+		auto base = std::make_shared<YAMLParser>();
+		auto local = std::make_shared<YAMLParser>();
+		bool ok = base->ParseYAMLBuffer("server:\n  host: base\n  port: 80\nname: app\n") && local->ParseYAMLBuffer("server:\n  port: 8080\n");
+		YAMLParser flattened;
+		{
+			YAMLLayeredDocument layered;
+			ok = ok && layered.PushLayer("base", base) && layered.PushLayer("local", local);
+			ok = ok && layered.GetInt("server.port") == 8080 && layered.GetString("server.host") == "base" && layered.GetSourceLayer("server.port") == "local";
+			ok = ok && layered.RemoveLayer("local") && layered.GetInt("server.port") == 80 && layered.PushLayer("local", local);
+			flattened = layered.Flatten();
+		}
+		base.reset();
+		local.reset();
+		ok = ok && flattened.GetInt("server.port") == 8080 && flattened.GetString("server.host") == "base" && flattened.GetString("name") == "app";
+		std::cout << "レイヤーの重ね合わせ: " << (ok ? "OK" : "NG") << std::endl;
+	}
+
+	// YAMLとJSONを相互に変換しても値が保たれ、最上位がオブジェクトでないJSONは変換しないことを確認
+	{
+		const char* yamlPath = "JSONTestData.yaml";
+		const char* jsonPath = "JSONTestData.json";
+		{
+			std::ofstream ofs(yamlPath, std::ios::binary);
+			ofs << "text: \"\\u3042\\ud83d\\ude00\"\nlist: [1, true, null]\nquoted: \"a: b\"\n";
+		}
+		YAMLParser converted;
+		bool ok = YAMLJSON::ConvertYAMLToJSON(yamlPath, jsonPath) && YAMLJSON::ParseJSON(jsonPath, converted);
+		std::ifstream json(jsonPath, std::ios::binary);
+		const std::string jsonText((std::istreambuf_iterator<char>(json)), std::istreambuf_iterator<char>());
+		json.close();
+		ok = ok && jsonText.find("\"\xE3\x81\x82\xF0\x9F\x98\x80\"") != std::string::npos && converted.GetInt("list.0") == 1 && converted.GetBool("list.1");
+		ok = ok && YAMLJSON::ConvertJSONToYAML(jsonPath, yamlPath) && converted.ParseYAML(yamlPath) && converted.GetString("quoted") == "a: b";
+		{
+			std::ofstream ofs(jsonPath, std::ios::binary);
+			ofs << "[1, 2]";
+		}
+		ok = ok && !YAMLJSON::ConvertJSONToYAML(jsonPath, yamlPath);
+		std::cout << "JSONとの相互変換: " << (ok ? "OK" : "NG") << std::endl;
+		std::filesystem::remove(yamlPath);
+		std::filesystem::remove(jsonPath);
+	}
+
 	yaml.reset();
 
 	return 0;